@@ -0,0 +1,68 @@
+#include "AllocationCounter.h"
+#include "AllocationTracker.h"
+#include <atomic>
+#include <new>
+
+namespace {
+	std::atomic<size_t> frameAllocations(0);
+	std::atomic<size_t> lastFrameAllocations(0);
+}
+
+#if defined(_DEBUG) || defined(ALLOCATION_TRACKING)
+void* operator new(size_t size) {
+	++frameAllocations;
+
+	void* memory = AllocationTracker::allocate(size);
+	if (!memory) throw std::bad_alloc();
+	return memory;
+}
+
+void* operator new[](size_t size) {
+	return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+	++frameAllocations;
+	return AllocationTracker::allocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept {
+	return operator new(size, tag);
+}
+
+void operator delete(void* memory) noexcept {
+	AllocationTracker::release(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+	AllocationTracker::release(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+	AllocationTracker::release(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept {
+	AllocationTracker::release(memory);
+}
+#endif
+
+bool AllocationCounter::isEnabled() {
+#if defined(_DEBUG) || defined(ALLOCATION_TRACKING)
+	return true;
+#else
+	return false;
+#endif
+}
+
+void AllocationCounter::beginFrame() {
+	lastFrameAllocations = frameAllocations.exchange(0);
+}
+
+size_t AllocationCounter::getLastFrameAllocations() {
+	return lastFrameAllocations;
+}
+
+size_t AllocationCounter::getCurrentFrameAllocations() {
+	return frameAllocations;
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include <SDL.h>
+#include <cstddef>
+
+// Counts global operator new calls from every thread, per frame. Only _DEBUG and ALLOCATION_TRACKING builds
+// replace operator new, other builds always report zero.
+class AllocationCounter {
+public:
+	static bool isEnabled();
+
+	// Called once at the top of the main loop, the count from the frame that just ended is kept
+	static void beginFrame();
+	static size_t getLastFrameAllocations();
+	static size_t getCurrentFrameAllocations();
+};
+
+// For frames that must not touch the heap on any thread, e.g. an idle menu frame that only waited for input
+#define ASSERT_NO_FRAME_ALLOCATIONS() SDL_assert(AllocationCounter::getCurrentFrameAllocations() == 0)
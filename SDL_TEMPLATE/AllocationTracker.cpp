@@ -0,0 +1,151 @@
+#include "AllocationTracker.h"
+#include <atomic>
+#include <cstdlib>
+
+namespace {
+	constexpr int TAG_COUNT = static_cast<int>(Allocation_Tag::COUNT);
+
+	// Keeps the block after it aligned for any type
+	struct alignas(16) BlockHeader {
+		size_t size;
+		int tag;
+	};
+
+	struct TagCounters {
+		std::atomic<long long> liveBytes;
+		std::atomic<long long> peakBytes;
+		std::atomic<size_t> totalAllocations;
+	};
+
+	// Zero-initialized before any dynamic initializer can allocate
+	TagCounters counters[TAG_COUNT];
+	thread_local Allocation_Tag currentTag = Allocation_Tag::UNTAGGED;
+
+	// Only touched by the main thread in sampleRates and getStats
+	size_t sampledAllocations[TAG_COUNT];
+	float allocationsPerSecond[TAG_COUNT];
+	Uint32 lastSampleTicks = 0;
+
+	void account(int tag, long long bytes) {
+		TagCounters& tagCounters = counters[tag];
+		const long long live = tagCounters.liveBytes += bytes;
+
+		if (bytes <= 0) return;
+
+		++tagCounters.totalAllocations;
+
+		long long peak = tagCounters.peakBytes;
+		while (live > peak && !tagCounters.peakBytes.compare_exchange_weak(peak, live)) {}
+	}
+}
+
+bool AllocationTracker::isEnabled() {
+#ifdef ALLOCATION_TRACKING
+	return true;
+#else
+	return false;
+#endif
+}
+
+Allocation_Tag AllocationTracker::getCurrentTag() {
+	return currentTag;
+}
+
+void AllocationTracker::setCurrentTag(Allocation_Tag tag) {
+	currentTag = tag;
+}
+
+void* AllocationTracker::allocate(size_t size) {
+#ifdef ALLOCATION_TRACKING
+	BlockHeader* header = static_cast<BlockHeader*>(std::malloc(sizeof(BlockHeader) + size));
+	if (!header) return nullptr;
+
+	header->size = size;
+	header->tag = static_cast<int>(currentTag);
+	account(header->tag, static_cast<long long>(size));
+	return header + 1;
+#else
+	return std::malloc(size ? size : 1);
+#endif
+}
+
+void AllocationTracker::release(void* memory) {
+	if (!memory) return;
+
+#ifdef ALLOCATION_TRACKING
+	BlockHeader* header = static_cast<BlockHeader*>(memory) - 1;
+	account(header->tag, -static_cast<long long>(header->size));
+	std::free(header);
+#else
+	std::free(memory);
+#endif
+}
+
+void AllocationTracker::addExternal(Allocation_Tag tag, long long bytes) {
+	if (!isEnabled()) return;
+
+	account(static_cast<int>(tag), bytes);
+}
+
+void AllocationTracker::sampleRates() {
+	const Uint32 now = SDL_GetTicks();
+	const Uint32 elapsed = now - lastSampleTicks;
+
+	if (elapsed < RATE_SAMPLE_INTERVAL_MS) return;
+
+	for (int tag = 0; tag < TAG_COUNT; tag++) {
+		const size_t total = counters[tag].totalAllocations;
+		allocationsPerSecond[tag] = (total - sampledAllocations[tag]) * 1000.0F / elapsed;
+		sampledAllocations[tag] = total;
+	}
+
+	lastSampleTicks = now;
+}
+
+AllocationTagStats AllocationTracker::getStats(Allocation_Tag tag) {
+	const int index = static_cast<int>(tag);
+	const long long live = counters[index].liveBytes;
+
+	return {
+		live > 0 ? static_cast<size_t>(live) : 0,
+		static_cast<size_t>(counters[index].peakBytes.load()),
+		counters[index].totalAllocations,
+		allocationsPerSecond[index]
+	};
+}
+
+const char* AllocationTracker::getTagName(Allocation_Tag tag) {
+	switch (tag) {
+	case Allocation_Tag::UNTAGGED: return "untagged";
+	case Allocation_Tag::SPAWN: return "spawn";
+	case Allocation_Tag::BULLETS: return "bullets";
+	case Allocation_Tag::TEXT: return "text";
+	case Allocation_Tag::HUD: return "hud";
+	case Allocation_Tag::AUDIO: return "audio";
+	default: return "";
+	}
+}
+
+void AllocationTracker::dump(std::ostream& stream) {
+	if (!isEnabled()) return;
+
+	const float uptimeSeconds = SDL_GetTicks() / 1000.0F;
+
+	stream << "Heap usage by tag (live / peak bytes, allocations, average per second):" << '\n';
+	for (int tag = 0; tag < TAG_COUNT; tag++) {
+		const AllocationTagStats stats = getStats(static_cast<Allocation_Tag>(tag));
+
+		stream << "  " << getTagName(static_cast<Allocation_Tag>(tag)) << ": "
+			<< stats.liveBytes << " / " << stats.peakBytes << ", "
+			<< stats.totalAllocations << ", "
+			<< (uptimeSeconds > 0.0F ? stats.totalAllocations / uptimeSeconds : 0.0F) << '\n';
+	}
+}
+
+AllocationTagScope::AllocationTagScope(Allocation_Tag tag) : previousTag(currentTag) {
+	if (previousTag == Allocation_Tag::UNTAGGED) currentTag = tag;
+}
+
+AllocationTagScope::~AllocationTagScope() {
+	currentTag = previousTag;
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <SDL.h>
+#include <cstddef>
+#include <iostream>
+
+enum class Allocation_Tag {
+	UNTAGGED,
+	SPAWN,
+	BULLETS,
+	TEXT,
+	HUD,
+	AUDIO,
+	COUNT
+};
+
+struct AllocationTagStats {
+	size_t liveBytes;
+	size_t peakBytes;
+	size_t totalAllocations;
+	float allocationsPerSecond;
+};
+
+// Opt-in heap accounting per subsystem, compiled in with ALLOCATION_TRACKING.
+// Every operator new block carries a small header with its size and the tag that was current on its thread,
+// so a block is credited back to the right tag no matter where it is freed.
+class AllocationTracker {
+private:
+	constexpr static Uint32 RATE_SAMPLE_INTERVAL_MS = 1000;
+
+public:
+	static bool isEnabled();
+
+	static Allocation_Tag getCurrentTag();
+	static void setCurrentTag(Allocation_Tag tag);
+
+	// Backing for the replaced global operator new/delete
+	static void* allocate(size_t size);
+	static void release(void* memory);
+
+	// For memory that never goes through operator new, like SDL_mixer chunks
+	static void addExternal(Allocation_Tag tag, long long bytes);
+
+	// Refreshes allocations per second once a sample interval has passed
+	static void sampleRates();
+
+	static AllocationTagStats getStats(Allocation_Tag tag);
+	static const char* getTagName(Allocation_Tag tag);
+	static void dump(std::ostream& stream);
+};
+
+// Tags allocations on this thread for its lifetime. The outermost scope wins,
+// so text rasterized for the HUD is still counted as HUD.
+class AllocationTagScope {
+private:
+	Allocation_Tag previousTag;
+
+public:
+	explicit AllocationTagScope(Allocation_Tag tag);
+	~AllocationTagScope();
+
+	AllocationTagScope(const AllocationTagScope&) = delete;
+	AllocationTagScope& operator=(const AllocationTagScope&) = delete;
+};
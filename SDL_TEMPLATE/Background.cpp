@@ -1,34 +1,24 @@
 #include "Background.h"
 #include "Game.h"
 #include "SDL_image.h"
-#include "AppInfo.h"
+#include "World.h"
+#include "RenderStats.h"
+#include "Logger.h"
 
-Background::Background() : background(nullptr), dimension(nullptr), srcRect(nullptr) {}
+Background::Background() : background(nullptr) {}
 
 void Background::checkIfBackgroundIsLoaded() {
 	if (background) {
-		std::cout << "Background loaded." << '\n';
-		setDimension();
-		setSrcRect();
+		LOG_DEBUG("Background loaded.");
+
+		SDL_Point dimension;
+		SDL_QueryTexture(background, nullptr, nullptr, &dimension.x, &dimension.y);
+		World::getInstance()->init(dimension);
 	} else {
-		std::cout << "Failed to load background: " << IMG_GetError() << '\n';
+		LOG_ERROR("Failed to load background: %s", IMG_GetError());
 	}
 }
 
-void Background::setDimension() {
-	dimension = new Dimension;
-
-	SDL_QueryTexture(background, nullptr, nullptr, &dimension->x, &dimension->y);
-}
-
-void Background::setSrcRect() {
-	srcRect = new SDL_Rect;
-	srcRect->w = SCREEN_WIDTH;
-	srcRect->h = SCREEN_HEIGHT;
-	srcRect->x = (SCREEN_WIDTH / 2);
-	srcRect->y = (SCREEN_HEIGHT / 2);
-}
-
 Background* Background::getInstance() {
 	static Background instance;
 	return &instance;
@@ -39,26 +29,7 @@ void Background::init() {
 	checkIfBackgroundIsLoaded();
 }
 
-void Background::render() {
-	SDL_RenderCopy(Game::getInstance()->getRenderer(), background, srcRect, nullptr);
-}
-
-bool Background::isRightEdge() {
-	return srcRect->x + srcRect->w >= dimension->x;
-}
-
-bool Background::isLeftEdge() {
-	return srcRect->x <= 0;
-}
-
-bool Background::isUpEdge() {
-	return srcRect->y <= 0;
-}
-
-bool Background::isDownEdge() {
-	return srcRect->y + srcRect->h >= dimension->y;
-}
-
-const SDL_Point& Background::getDimension() const {
-	return *dimension;
+void Background::render(const SDL_Rect& srcRect) {
+	SDL_RenderCopy(Game::getInstance()->getRenderer(), background, &srcRect, nullptr);
+	RenderStats::countDrawCalls(1);
 }
\ No newline at end of file
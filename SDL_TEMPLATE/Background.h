@@ -1,24 +1,16 @@
 #pragma once
 #include <SDL.h>
-#include <iostream>
-
-using Dimension = SDL_Point;
 
+// The world's backdrop. Its texture sets the size of the World when it loads
 class Background {
 private:
 	Background();
 
-private:
-	Dimension* dimension;
-
 public:
 	SDL_Texture* background;
-	SDL_Rect* srcRect;
 
 private:
 	void checkIfBackgroundIsLoaded();
-	void setDimension();
-	void setSrcRect();
 
 public:
 	Background(const Background&) = delete;
@@ -29,12 +21,5 @@ public:
 	static Background* getInstance();
 
 	void init();
-	void render();
-
-	bool isRightEdge();
-	bool isLeftEdge();
-	bool isUpEdge();
-	bool isDownEdge();
-	const SDL_Point& getDimension() const;
+	void render(const SDL_Rect& srcRect);
 };
-
@@ -1,6 +1,8 @@
 #include "Bar.h"
-#include "Game.h"
+#include "GameHost.h"
 #include "BorderManager.h"
+#include "RenderStats.h"
+#include "RenderTargetScope.h"
 
 Bar::Bar() : mTexture(nullptr) {}
 
@@ -10,7 +12,7 @@ Bar::~Bar() {
 
 void Bar::initTexture() {
     mTexture = SDL_CreateTexture(
-        Game::getInstance()->getRenderer(),
+        GameHost::getInstance()->getRenderer(),
         SDL_PIXELFORMAT_RGBA8888,
         SDL_TEXTUREACCESS_TARGET,
         mDstRect.w,
@@ -57,18 +59,21 @@ void Bar::update(float currentAmount) {
 }
 
 void Bar::render() {
-	SDL_Renderer* renderer = Game::getInstance()->getRenderer();
+	SDL_Renderer* renderer = GameHost::getInstance()->getRenderer();
 
 	SDL_SetTextureBlendMode(mTexture, SDL_BLENDMODE_BLEND);
-	SDL_SetRenderTarget(renderer, mTexture);
-	SDL_SetRenderDrawColor(renderer, 110, 110, 110, 120);
-	SDL_RenderClear(renderer);
+	{
+		RenderTargetScope target(renderer, mTexture);
+		SDL_SetRenderDrawColor(renderer, 110, 110, 110, 120);
+		SDL_RenderClear(renderer);
 
-	SDL_SetRenderDrawColor(renderer, mColor.r, mColor.g, mColor.b, mColor.a);
-	
-	SDL_RenderFillRect(renderer, &sizeRect);
+		SDL_SetRenderDrawColor(renderer, mColor.r, mColor.g, mColor.b, mColor.a);
+
+		SDL_RenderFillRect(renderer, &sizeRect);
+		RenderStats::countDrawCalls(1);
+	}
 
-	SDL_SetRenderTarget(renderer, nullptr);
 	SDL_RenderCopy(renderer, mTexture, nullptr, &mDstRect);
+	RenderStats::countDrawCalls(1);
 	renderBorder(renderer);
 }
\ No newline at end of file
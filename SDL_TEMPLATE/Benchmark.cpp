@@ -0,0 +1,197 @@
+#include "Benchmark.h"
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+BenchmarkState::BenchmarkState(const std::vector<int>& arguments, size_t maxIterations) :
+	arguments(arguments), maxIterations(maxIterations), iteration(0), started(false), timing(false),
+	startCounter(0), elapsedCounter(0) {}
+
+bool BenchmarkState::keepRunning() {
+	if (started) {
+		++iteration;
+	} else {
+		started = true;
+		resumeTiming();
+	}
+
+	if (iteration < maxIterations) return true;
+
+	pauseTiming();
+	return false;
+}
+
+void BenchmarkState::pauseTiming() {
+	if (!timing) return;
+
+	elapsedCounter += SDL_GetPerformanceCounter() - startCounter;
+	timing = false;
+}
+
+void BenchmarkState::resumeTiming() {
+	if (timing) return;
+
+	startCounter = SDL_GetPerformanceCounter();
+	timing = true;
+}
+
+int BenchmarkState::getArgument(size_t index) const {
+	return index < arguments.size() ? arguments[index] : 0;
+}
+
+size_t BenchmarkState::getIteration() const {
+	return iteration;
+}
+
+void BenchmarkState::setCounter(const std::string& name, double value) {
+	counters[name] = value;
+}
+
+size_t BenchmarkState::getIterations() const {
+	return maxIterations;
+}
+
+double BenchmarkState::getElapsedNs() const {
+	return elapsedCounter * 1000000000.0 / SDL_GetPerformanceFrequency();
+}
+
+const std::map<std::string, double>& BenchmarkState::getCounters() const {
+	return counters;
+}
+
+std::vector<Benchmark::Case>& Benchmark::getCases() {
+	static std::vector<Case> cases;
+	return cases;
+}
+
+void Benchmark::add(const std::string& name, Body body, std::vector<std::vector<int>> argumentSets) {
+	if (argumentSets.empty()) argumentSets.emplace_back();
+
+	getCases().push_back({ name, std::move(body), std::move(argumentSets) });
+}
+
+std::string Benchmark::getRunName(const std::string& name, const std::vector<int>& arguments) {
+	std::string runName = name;
+
+	for (const auto& argument : arguments) {
+		runName += '/';
+		runName += std::to_string(argument);
+	}
+
+	return runName;
+}
+
+// Same growth rule as Google Benchmark: aim 40% past the minimum time, never more than 10x per step
+Benchmark::Result Benchmark::runCase(const std::string& runName, const Body& body, const std::vector<int>& arguments, double minTimeSeconds) {
+	const double minTimeNs = minTimeSeconds * 1000000000.0;
+	size_t iterations = 1;
+
+	while (true) {
+		BenchmarkState state(arguments, iterations);
+		body(state);
+
+		const double elapsedNs = state.getElapsedNs();
+
+		if (elapsedNs >= minTimeNs || iterations >= MAX_ITERATIONS) {
+			return { runName, iterations, elapsedNs / iterations, state.getCounters() };
+		}
+
+		double multiplier = elapsedNs > 0.0 ? minTimeNs * 1.4 / elapsedNs : 10.0;
+		if (multiplier > 10.0) multiplier = 10.0;
+
+		size_t nextIterations = static_cast<size_t>(iterations * multiplier) + 1;
+		if (nextIterations > MAX_ITERATIONS) nextIterations = MAX_ITERATIONS;
+		iterations = nextIterations;
+	}
+}
+
+void Benchmark::writeJsonString(std::ostream& out, const std::string& text) {
+	out << '"';
+
+	for (const char character : text) {
+		if (character == '"' || character == '\\') out << '\\';
+		out << character;
+	}
+
+	out << '"';
+}
+
+void Benchmark::writeJson(std::ostream& out, const std::vector<Result>& results, const char* executable) {
+#ifdef NDEBUG
+	const char* buildType = "release";
+#else
+	const char* buildType = "debug";
+#endif
+
+	out << "{\n  \"context\": {\n    \"executable\": ";
+	writeJsonString(out, executable ? executable : "");
+	out << ",\n    \"num_cpus\": " << SDL_GetCPUCount();
+	out << ",\n    \"library_build_type\": \"" << buildType << "\"\n  },\n";
+	out << "  \"benchmarks\": [";
+
+	out << std::setprecision(12);
+
+	for (size_t resultIndex = 0; resultIndex < results.size(); resultIndex++) {
+		const Result& result = results[resultIndex];
+
+		out << (resultIndex == 0 ? "\n" : ",\n") << "    {\n      \"name\": ";
+		writeJsonString(out, result.name);
+		out << ",\n      \"run_type\": \"iteration\"";
+		out << ",\n      \"iterations\": " << result.iterations;
+		out << ",\n      \"real_time\": " << result.realTimeNs;
+		out << ",\n      \"time_unit\": \"ns\"";
+
+		for (const auto& counter : result.counters) {
+			out << ",\n      ";
+			writeJsonString(out, counter.first);
+			out << ": " << counter.second;
+		}
+
+		out << "\n    }";
+	}
+
+	out << "\n  ]\n}\n";
+}
+
+int Benchmark::runAll(int argc, char* argv[]) {
+	const char* filter = "";
+	const char* outPath = DEFAULT_OUT_PATH;
+	double minTimeSeconds = DEFAULT_MIN_TIME_SECONDS;
+
+	for (int argIndex = 1; argIndex < argc; argIndex++) {
+		const char* arg = argv[argIndex];
+
+		if (std::strncmp(arg, "--benchmark_filter=", 19) == 0) filter = arg + 19;
+		else if (std::strncmp(arg, "--benchmark_out=", 16) == 0) outPath = arg + 16;
+		else if (std::strncmp(arg, "--benchmark_min_time=", 21) == 0) minTimeSeconds = std::atof(arg + 21);
+	}
+
+	std::vector<Result> results;
+
+	for (const auto& benchmarkCase : getCases()) {
+		for (const auto& arguments : benchmarkCase.argumentSets) {
+			const std::string runName = getRunName(benchmarkCase.name, arguments);
+			if (runName.find(filter) == std::string::npos) continue;
+
+			results.push_back(runCase(runName, benchmarkCase.body, arguments, minTimeSeconds));
+
+			const Result& result = results.back();
+			char line[RESULT_LINE_CAPACITY];
+			SDL_snprintf(line, sizeof(line), "%-40s %14.0f ns %12u", result.name.c_str(), result.realTimeNs,
+				static_cast<unsigned>(result.iterations));
+			std::cout << line << '\n';
+		}
+	}
+
+	std::ofstream out(outPath);
+	if (!out) {
+		std::cerr << "Failed to open benchmark output " << outPath << '\n';
+		return 1;
+	}
+
+	writeJson(out, results, argc > 0 ? argv[0] : nullptr);
+	std::cout << "Benchmark results written to " << outPath << '\n';
+	return 0;
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <SDL.h>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Handed to every benchmark body, shaped like Google Benchmark's state so cases read the same way:
+//     while (state.keepRunning()) { ... }
+class BenchmarkState {
+private:
+	std::vector<int> arguments;
+	size_t maxIterations;
+	size_t iteration;
+	bool started;
+	bool timing;
+	Uint64 startCounter;
+	Uint64 elapsedCounter;
+	std::map<std::string, double> counters;
+
+public:
+	BenchmarkState(const std::vector<int>& arguments, size_t maxIterations);
+
+	bool keepRunning();
+	void pauseTiming(); // Per-iteration setup goes between pause and resume
+	void resumeTiming();
+
+	int getArgument(size_t index) const;
+	size_t getIteration() const; // Zero-based, the iteration currently being timed
+	void setCounter(const std::string& name, double value); // Reported next to the timings as-is
+
+	size_t getIterations() const;
+	double getElapsedNs() const;
+	const std::map<std::string, double>& getCounters() const;
+};
+
+// Minimal runner in the spirit of Google Benchmark: every case is rerun with more iterations until it
+// takes at least the minimum time, then printed and written out in Google Benchmark's JSON layout.
+class Benchmark {
+public:
+	using Body = std::function<void(BenchmarkState&)>;
+
+private:
+	struct Case {
+		std::string name;
+		Body body;
+		std::vector<std::vector<int>> argumentSets;
+	};
+
+	struct Result {
+		std::string name;
+		size_t iterations;
+		double realTimeNs; // Per iteration
+		std::map<std::string, double> counters;
+	};
+
+	constexpr static size_t MAX_ITERATIONS = 1000000;
+	constexpr static double DEFAULT_MIN_TIME_SECONDS = 0.5;
+	constexpr static const char* DEFAULT_OUT_PATH = "benchmark_results.json";
+	constexpr static int RESULT_LINE_CAPACITY = 128;
+
+private:
+	static std::vector<Case>& getCases();
+	static std::string getRunName(const std::string& name, const std::vector<int>& arguments);
+	static Result runCase(const std::string& runName, const Body& body, const std::vector<int>& arguments, double minTimeSeconds);
+	static void writeJsonString(std::ostream& out, const std::string& text);
+	static void writeJson(std::ostream& out, const std::vector<Result>& results, const char* executable);
+
+public:
+	// One run per argument set, named "<name>/<arg>/<arg>". No sets runs the case once without arguments.
+	static void add(const std::string& name, Body body, std::vector<std::vector<int>> argumentSets = {});
+
+	// Understands --benchmark_filter=<substring>, --benchmark_out=<path> and --benchmark_min_time=<seconds>
+	static int runAll(int argc, char* argv[]);
+};
@@ -0,0 +1,45 @@
+#include "BenchmarkScenario.h"
+#include "WorldSnapshot.h"
+#include "Game.h"
+#include "World.h"
+#include "EnemyType.h"
+#include "PrototypeRegistry.h"
+
+namespace {
+	constexpr int ENEMY_MIX_COUNT = 16;
+	constexpr Prototype_Type ENEMY_MIX[ENEMY_MIX_COUNT] = {
+		Prototype_Type::NORMAL_ENEMY,
+		Prototype_Type::NORMAL_ENEMY,
+		Prototype_Type::NORMAL_ENEMY_FAST,
+		Prototype_Type::NORMAL_ENEMY,
+		Prototype_Type::MEDIUM_ENEMY,
+		Prototype_Type::NORMAL_ENEMY_FAST,
+		Prototype_Type::MEDIUM_ENEMY_FAST,
+		Prototype_Type::NORMAL_ENEMY,
+		Prototype_Type::NORMAL_ENEMY,
+		Prototype_Type::NORMAL_ENEMY_FAST,
+		Prototype_Type::NORMAL_ENEMY,
+		Prototype_Type::MEDIUM_ENEMY,
+		Prototype_Type::NORMAL_ENEMY,
+		Prototype_Type::LARGE_ENEMY,
+		Prototype_Type::NORMAL_ENEMY,
+		Prototype_Type::LARGE_ENEMY_FAST
+	};
+}
+
+void BenchmarkScenario::build(WorldSnapshot& scenario, size_t enemyCount, std::mt19937& rng) {
+	Game::getInstance()->startGame();
+	scenario.capture();
+
+	const SDL_Point& worldDimension = World::getInstance()->getDimension();
+
+	for (size_t enemyIndex = 0; enemyIndex < enemyCount; enemyIndex++) {
+		const Prototype_Type type = ENEMY_MIX[enemyIndex % ENEMY_MIX_COUNT];
+		const EnemyType* prototype = dynamic_cast<const EnemyType*>(PrototypeRegistry::getInstance()->findPrototype(type));
+
+		std::uniform_int_distribution<int> distX(BORDER_ALLOWANCE, worldDimension.x - BORDER_ALLOWANCE - prototype->getDimension().x);
+		std::uniform_int_distribution<int> distY(BORDER_ALLOWANCE, worldDimension.y - BORDER_ALLOWANCE - prototype->getDimension().y);
+
+		scenario.enemies.push_back({ type, { distX(rng), distY(rng) }, prototype->getHealth() });
+	}
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include <random>
+
+struct WorldSnapshot;
+
+// Seeded world shared by EcsBenchmark and SimulationBenchmarks, so both measure the same crowd.
+// Needs Game::initAll for prototypes and the world size.
+class BenchmarkScenario {
+public:
+	// One player from Game::startGame and a mixed enemy crowd over the whole world, drawn from rng.
+	// Callers add their own bullets from the same rng afterwards.
+	static void build(WorldSnapshot& scenario, size_t enemyCount, std::mt19937& rng);
+};
@@ -1,16 +1,18 @@
 #include "Bullet.h"
 #include "GameEnums.h"
 #include "AppInfo.h"
-#include "Background.h"
-#include "Game.h"
+#include "World.h"
+#include "RenderList.h"
 #include "TextureType.h"
 #include "WaveManager.h"
 #include "EnemyType.h"
-#include "FastEnemy.h"
 #include "Player.h"
+#include "WorldSnapshot.h"
 
 std::vector<std::unique_ptr<Bullet>> Bullet::bullets;
 
+std::shared_ptr<TextureType> Bullet::sharedTexture;
+
 Bullet::Bullet() : remove(std::make_unique<bool>(false)) {}
 
 Bullet::Bullet(const Bullet& other)
@@ -41,9 +43,9 @@ void Bullet::initTexture(std::shared_ptr<TextureType> textureType) {
 
 void Bullet::checkCollision() {
 	if (position->x < BORDER_ALLOWANCE * 1.5 ||
-		position->x + BULLET_DIMENSION.x > Background::getInstance()->getDimension().x - (BORDER_ALLOWANCE * 1.5) ||
+		position->x + BULLET_DIMENSION.x > World::getInstance()->getDimension().x - (BORDER_ALLOWANCE * 1.5) ||
 		position->y < BORDER_ALLOWANCE * 1.5 ||
-		position->y + BULLET_DIMENSION.y > Background::getInstance()->getDimension().y - (BORDER_ALLOWANCE)) {
+		position->y + BULLET_DIMENSION.y > World::getInstance()->getDimension().y - (BORDER_ALLOWANCE)) {
 		*remove = true;
 	}
 
@@ -71,27 +73,22 @@ void Bullet::update() {
 	checkCollision();
 }
 
-void Bullet::render() {
-	float angle = static_cast<float>(std::atan2(*directionY, *directionX) * (180.0f / M_PI));
-
-	SDL_Rect dstRect = {
-	position->x - Background::getInstance()->srcRect->x,
-	position->y - Background::getInstance()->srcRect->y,
-	BULLET_DIMENSION.x,
-	BULLET_DIMENSION.y
+void Bullet::saveRenderState(SpriteCommand& sprite) const {
+	sprite.texture = textureType->texture;
+	sprite.dstRect = {
+		position->x - World::getInstance()->srcRect.x,
+		position->y - World::getInstance()->srcRect.y,
+		BULLET_DIMENSION.x,
+		BULLET_DIMENSION.y
 	};
+	sprite.angle = std::atan2(*directionY, *directionX) * (180.0 / M_PI);
+}
 
-	SDL_SetRenderTarget(Game::getInstance()->getRenderer(), Background::getInstance()->background);
-	SDL_RenderCopyEx(
-		Game::getInstance()->getRenderer(),
-		textureType->texture,
-		nullptr,
-		&dstRect,
-		angle,
-		nullptr, 
-		SDL_FLIP_NONE
-	);
-	SDL_SetRenderTarget(Game::getInstance()->getRenderer(), nullptr);
+void Bullet::saveSnapshot(BulletSnapshot& snapshot) const {
+	snapshot.playerID = player->getID();
+	snapshot.position = *position;
+	snapshot.directionX = *directionX;
+	snapshot.directionY = *directionY;
 }
 
 std::shared_ptr<Prototype> Bullet::clone() const {
@@ -6,6 +6,8 @@
 
 class TextureType;
 class Player;
+struct BulletSnapshot;
+struct SpriteCommand;
 
 class Bullet : public Prototype {
 public:
@@ -23,6 +25,7 @@ public:
 public:
 	static constexpr SDL_Point BULLET_DIMENSION = { 10, 10 };
 	static std::vector<std::unique_ptr<Bullet>> bullets;
+	static std::shared_ptr<TextureType> sharedTexture; // Loaded on the main thread by Game::initBullet
 
 private:
 	void checkCollision();
@@ -38,7 +41,8 @@ public:
 	void initMovementSpeed(float movementSpeed);
 	void initTexture(std::shared_ptr<TextureType> textureType);
 	void update();
-	void render();
+	void saveRenderState(SpriteCommand& sprite) const;
+	void saveSnapshot(BulletSnapshot& snapshot) const;
 
 	std::shared_ptr<Prototype> clone() const override;
 };
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+#include <SDL.h>
+
+// Plain component data stored densely by EntityRegistry, positions are in world space
+
+struct Transform {
+	SDL_Point position;
+	SDL_Point dimension;
+};
+
+struct Velocity {
+	float directionX;
+	float directionY;
+	float speed;
+	bool steered; // Direction is resampled from the flow field every tick
+};
+
+struct Health {
+	int current;
+	int score; // Awarded to whoever removes the last point
+};
+
+struct Sprite {
+	SDL_Texture* texture;
+	double angle;
+};
+
+struct Collider {
+	int contactDamage;
+};
+
+enum class Faction_Type {
+	PLAYER,
+	ENEMY,
+	BULLET
+};
+
+struct Faction {
+	Faction_Type type;
+};
@@ -0,0 +1,38 @@
+#include "Cooldown.h"
+#include "GameClock.h"
+
+Cooldown::Cooldown() : lastTriggerNs(0), triggered(false) {}
+
+bool Cooldown::tryTrigger(Uint32 cooldownMs) {
+	const Uint64 now = GameClock::getInstance()->getTimeNs();
+
+	if (triggered && now - lastTriggerNs <= cooldownMs * GameClock::NANOSECONDS_PER_MILLISECOND) return false;
+
+	lastTriggerNs = now;
+	triggered = true;
+	return true;
+}
+
+void Cooldown::reset() {
+	triggered = false;
+}
+
+// Game time keeps running across a rewind, so the trigger is placed elapsedTime before now
+void Cooldown::restore(Uint32 elapsedTime, bool wasTriggered) {
+	const Uint64 now = GameClock::getInstance()->getTimeNs();
+	const Uint64 elapsedNs = elapsedTime * GameClock::NANOSECONDS_PER_MILLISECOND;
+
+	triggered = wasTriggered;
+	lastTriggerNs = wasTriggered && now > elapsedNs ? now - elapsedNs : 0;
+}
+
+Uint32 Cooldown::getElapsedTime() const {
+	if (!triggered) return 0;
+
+	const Uint64 elapsedMs = (GameClock::getInstance()->getTimeNs() - lastTriggerNs) / GameClock::NANOSECONDS_PER_MILLISECOND;
+	return static_cast<Uint32>(SDL_min(elapsedMs, static_cast<Uint64>(SDL_MAX_UINT32)));
+}
+
+bool Cooldown::hasTriggered() const {
+	return triggered;
+}
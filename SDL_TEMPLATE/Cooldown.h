@@ -0,0 +1,19 @@
+#pragma once
+#include <SDL.h>
+
+// Per-entity cooldown on game time, so it stops while paused and speeds up with the clock's time scale
+class Cooldown {
+private:
+	Uint64 lastTriggerNs;
+	bool triggered;
+
+public:
+	Cooldown();
+
+	// True and restarted once more than cooldownMs passed since the last trigger, the first call always passes
+	bool tryTrigger(Uint32 cooldownMs);
+	void reset();
+	void restore(Uint32 elapsedTime, bool wasTriggered);
+	Uint32 getElapsedTime() const; // Milliseconds since the last trigger, 0 before the first one
+	bool hasTriggered() const;
+};
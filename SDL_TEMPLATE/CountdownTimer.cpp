@@ -1,7 +1,14 @@
 #include "CountdownTimer.h"
+#include "GameClock.h"
 #include <iostream>
 
-CountdownTimer::CountdownTimer() : mStartTicks(0), mPauseTicks(0), mDuration(0), mFinished(false), mStarted(false)  {}
+namespace {
+	Uint64 now() {
+		return GameClock::getInstance()->getTimeNs();
+	}
+}
+
+CountdownTimer::CountdownTimer() : mStartNs(0), mPauseNs(0), mDuration(0), mElapsedTime(0), mFinished(false), mStarted(false), mPaused(false) {}
 
 void CountdownTimer::setDuration(Uint32 mMilliseconds) {
 	mDuration = mMilliseconds;
@@ -11,37 +18,47 @@ void CountdownTimer::start() {
 	mStarted = true;
 	mPaused = false;
 	mFinished = false;
-	mStartTicks = SDL_GetTicks();
-	mPauseTicks = 0;
+	mStartNs = now();
+	mPauseNs = 0;
 }
 
 void CountdownTimer::setFinish() {
 	mFinished = true;
 	mStarted = false;
 	mPaused = false;
-	mStartTicks = 0;
-	mPauseTicks = 0;
+	mStartNs = 0;
+	mPauseNs = 0;
 }
 
 void CountdownTimer::pause() {
 	if (mPaused) return;
 
 	mPaused = true;
-	mPauseTicks = SDL_GetTicks() - mStartTicks;
+	mPauseNs = now() - mStartNs;
 }
 
 void CountdownTimer::unpause() {
 	if (!mPaused) return;
 
 	mPaused = false;
-	mStartTicks = SDL_GetTicks() - mPauseTicks;
+	mStartNs = now() - mPauseNs;
+}
+
+void CountdownTimer::restore(Uint32 duration, Uint32 elapsedTime, bool started) {
+	mDuration = duration;
+	mStarted = started;
+	mFinished = !started;
+	mPaused = false;
+	const Uint64 elapsedNs = elapsedTime * GameClock::NANOSECONDS_PER_MILLISECOND;
+	mStartNs = started && now() > elapsedNs ? now() - elapsedNs : 0;
+	mPauseNs = 0;
 }
 
 Uint32 CountdownTimer::getElapsedTime() {
 	if (mPaused) {
-		return mPauseTicks;
+		return static_cast<Uint32>(mPauseNs / GameClock::NANOSECONDS_PER_MILLISECOND);
 	} else if (mStarted) {
-		return SDL_GetTicks() - mStartTicks;
+		return static_cast<Uint32>((now() - mStartNs) / GameClock::NANOSECONDS_PER_MILLISECOND);
 	}
 	return 0;
 }
@@ -1,10 +1,11 @@
 #pragma once
 #include "SDL.h"
 
+// Millisecond API over GameClock nanoseconds, so countdowns pause and scale with game time
 class CountdownTimer {
 private:
-	Uint32 mStartTicks;
-	Uint32 mPauseTicks;
+	Uint64 mStartNs;
+	Uint64 mPauseNs; // Elapsed time when paused
 	Uint32 mDuration;
 	Uint32 mElapsedTime;
 	bool mFinished;
@@ -18,6 +19,7 @@ public:
 	void setFinish();
 	void pause();
 	void unpause();
+	void restore(Uint32 duration, Uint32 elapsedTime, bool started);
 	Uint32 getElapsedTime();
 	Uint32 getDurationTime();
 	const bool isFinished();
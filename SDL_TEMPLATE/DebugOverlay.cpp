@@ -0,0 +1,103 @@
+#include "DebugOverlay.h"
+#include "Game.h"
+#include "Text.h"
+#include "AllocationTracker.h"
+#include "AllocationCounter.h"
+#include "FrameArena.h"
+#include "RenderStats.h"
+#include "FPSManager.h"
+
+DebugOverlay::DebugOverlay() : visible(false), lastRefreshTicks(0), backgroundRect({ 0, 0, 0, 0 }) {}
+
+DebugOverlay* DebugOverlay::getInstance() {
+	static DebugOverlay instance;
+	return &instance;
+}
+
+void DebugOverlay::toggle() {
+	visible = !visible;
+	lastRefreshTicks = 0;
+}
+
+Uint32 DebugOverlay::getMsUntilRefresh() const {
+	if (!visible) return SDL_MAX_UINT32;
+	if (lastRefreshTicks == 0) return 0;
+
+	const Uint32 elapsed = SDL_GetTicks() - lastRefreshTicks;
+	return elapsed >= REFRESH_INTERVAL_MS ? 0 : REFRESH_INTERVAL_MS - elapsed;
+}
+
+void DebugOverlay::setLine(size_t lineIndex, const char* text) {
+	if (lineIndex >= lines.size()) {
+		std::unique_ptr<Text> line = std::make_unique<Text>();
+		line->setFont(Font::MOTION_CONTROL_BOLD);
+		line->setColor({ 255, 255, 255, 255 });
+		lines.push_back(std::move(line));
+	}
+
+	const int width = static_cast<int>(SDL_strlen(text)) * CHARACTER_WIDTH;
+	lines[lineIndex]->setDstRect({ MARGIN, MARGIN + static_cast<int>(lineIndex) * LINE_HEIGHT, width, LINE_HEIGHT });
+	lines[lineIndex]->setText(text);
+	lines[lineIndex]->loadText();
+
+	if (width + MARGIN * 2 > backgroundRect.w) backgroundRect.w = width + MARGIN * 2;
+}
+
+void DebugOverlay::refresh() {
+	char text[LINE_CAPACITY];
+	size_t lineIndex = 0;
+
+	backgroundRect = { 0, 0, 0, 0 };
+
+	const FramePacingStats& pacing = FPSManager::getInstance()->getStats();
+	SDL_snprintf(text, sizeof(text), "%.1f FPS%s  frame %.2f  jitter %.2f  worst %.2f  overshoot %.2f ms",
+		pacing.averageFps, FPSManager::getInstance()->isUncapped() ? " uncapped" : "", pacing.meanFrameMs,
+		pacing.frameStdDevMs, pacing.worstFrameMs, pacing.sleepOvershootMs);
+	setLine(lineIndex++, text);
+
+	SDL_snprintf(text, sizeof(text), "Frame allocations: %u   arena peak: %u KB",
+		static_cast<unsigned>(AllocationCounter::getLastFrameAllocations()),
+		static_cast<unsigned>(FrameArena::getThreadArena().getPeakBytes() / 1024));
+	setLine(lineIndex++, text);
+
+	if (!AllocationTracker::isEnabled()) {
+		setLine(lineIndex++, "Heap tags off, build with ALLOCATION_TRACKING");
+	} else {
+		setLine(lineIndex++, "Heap tag      live KB    peak KB    alloc/s");
+
+		for (int tag = 0; tag < static_cast<int>(Allocation_Tag::COUNT); tag++) {
+			const AllocationTagStats stats = AllocationTracker::getStats(static_cast<Allocation_Tag>(tag));
+
+			SDL_snprintf(text, sizeof(text), "%-10s %9.1f %10.1f %10.0f",
+				AllocationTracker::getTagName(static_cast<Allocation_Tag>(tag)),
+				stats.liveBytes / 1024.0, stats.peakBytes / 1024.0, stats.allocationsPerSecond);
+			setLine(lineIndex++, text);
+		}
+	}
+
+	lines.resize(lineIndex);
+	backgroundRect.h = static_cast<int>(lineIndex) * LINE_HEIGHT + MARGIN * 2;
+}
+
+void DebugOverlay::render() {
+	AllocationTracker::sampleRates();
+
+	if (!visible) return;
+
+	const Uint32 now = SDL_GetTicks();
+	if (lastRefreshTicks == 0 || now - lastRefreshTicks >= REFRESH_INTERVAL_MS) {
+		refresh();
+		lastRefreshTicks = now;
+	}
+
+	SDL_Renderer* renderer = Game::getInstance()->getRenderer();
+
+	SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+	SDL_SetRenderDrawColor(renderer, BACKGROUND_COLOR.r, BACKGROUND_COLOR.g, BACKGROUND_COLOR.b, BACKGROUND_COLOR.a);
+	SDL_RenderFillRect(renderer, &backgroundRect);
+	RenderStats::countDrawCalls(1);
+
+	for (const auto& line : lines) {
+		line->render();
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <SDL.h>
+#include <memory>
+#include <vector>
+
+class Text;
+
+// Profiler overlay toggled with F3, drawn over every state. Texts are only re-rasterized once per refresh interval.
+class DebugOverlay {
+private:
+	DebugOverlay();
+
+public:
+	DebugOverlay(const DebugOverlay&) = delete;
+	DebugOverlay& operator=(const DebugOverlay&) = delete;
+	DebugOverlay(DebugOverlay&&) = delete;
+	DebugOverlay& operator=(DebugOverlay&&) = delete;
+
+	static DebugOverlay* getInstance();
+
+private:
+	constexpr static Uint32 REFRESH_INTERVAL_MS = 500;
+	constexpr static int LINE_HEIGHT = 16;
+	constexpr static int CHARACTER_WIDTH = 8;
+	constexpr static int MARGIN = 8;
+	constexpr static int LINE_CAPACITY = 96;
+	constexpr static SDL_Color BACKGROUND_COLOR = { 0, 0, 0, 170 };
+
+	bool visible;
+	Uint32 lastRefreshTicks;
+	std::vector<std::unique_ptr<Text>> lines;
+	SDL_Rect backgroundRect;
+
+private:
+	void setLine(size_t lineIndex, const char* text);
+	void refresh();
+
+public:
+	void toggle();
+	void render();
+
+	// How long an idle loop may sleep before the numbers are due again, SDL_MAX_UINT32 while hidden
+	Uint32 getMsUntilRefresh() const;
+};
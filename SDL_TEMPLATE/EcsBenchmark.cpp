@@ -0,0 +1,183 @@
+#include "EcsBenchmark.h"
+#include "BenchmarkScenario.h"
+#include "EntityRegistry.h"
+#include "EntitySystems.h"
+#include "WorldSnapshot.h"
+#include "Game.h"
+#include "InvokerPlaying.h"
+#include "Player.h"
+#include "Bullet.h"
+#include "EnemyType.h"
+#include "TextureType.h"
+#include "PrototypeRegistry.h"
+#include "WaveManager.h"
+#include "RenderList.h"
+#include "JobSystem.h"
+#include "FrameArena.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+
+namespace {
+	std::shared_ptr<EnemyType> getEnemyPrototype(Prototype_Type type) {
+		return std::dynamic_pointer_cast<EnemyType>(PrototypeRegistry::getInstance()->getPrototype(type));
+	}
+
+	double getElapsedMs(Uint64 start) {
+		return (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+	}
+}
+
+// BenchmarkScenario's crowd, plus bullets fanned out around the player
+void EcsBenchmark::buildLayout(WorldSnapshot& layout, size_t entityCount) {
+	std::mt19937 rng(LAYOUT_SEED);
+
+	const size_t bulletCount = entityCount / BULLET_SHARE;
+	const size_t enemyCount = entityCount > bulletCount + 1 ? entityCount - bulletCount - 1 : 0;
+
+	BenchmarkScenario::build(layout, enemyCount, rng);
+	const PlayerSnapshot& player = layout.players.front();
+
+	std::uniform_real_distribution<float> angleDistribution(0.0F, 6.2831853F);
+	std::uniform_int_distribution<int> spreadDistribution(0, BULLET_SPREAD);
+
+	for (size_t bulletIndex = 0; bulletIndex < bulletCount; bulletIndex++) {
+		const float angle = angleDistribution(rng);
+		const int spread = spreadDistribution(rng);
+
+		BulletSnapshot bullet;
+		bullet.playerID = player.ID;
+		bullet.directionX = std::cos(angle);
+		bullet.directionY = std::sin(angle);
+		bullet.position = {
+			player.platformPosition.x + static_cast<int>(bullet.directionX * spread),
+			player.platformPosition.y + static_cast<int>(bullet.directionY * spread)
+		};
+		layout.bullets.push_back(bullet);
+	}
+}
+
+void EcsBenchmark::fillRegistry(const WorldSnapshot& layout, EntityRegistry& registry) {
+	registry.clear();
+
+	for (const auto& player : layout.players) {
+		// Platform position is the player's center in world space
+		const SDL_Point dimension = { Player::PLAYER_DIMENSION.x, Player::PLAYER_DIMENSION.y };
+		const SDL_Point position = { player.platformPosition.x - dimension.x / 2, player.platformPosition.y - dimension.y / 2 };
+
+		const Entity entity = registry.create();
+		registry.add(entity, Transform{ position, dimension });
+		registry.add(entity, Health{ player.heartAmount, 0 });
+		registry.add(entity, Sprite{ Player::textureType->texture, 0.0 });
+		registry.add(entity, Collider{ 0 });
+		registry.add(entity, Faction{ Faction_Type::PLAYER });
+	}
+
+	for (const auto& bullet : layout.bullets) {
+		const Entity entity = registry.create();
+		registry.add(entity, Transform{ bullet.position, { Bullet::BULLET_DIMENSION.x, Bullet::BULLET_DIMENSION.y } });
+		registry.add(entity, Velocity{ bullet.directionX, bullet.directionY, static_cast<float>(Player::BULLET_SPEED_SCALAR), false });
+		registry.add(entity, Sprite{ Bullet::sharedTexture->texture, 0.0 });
+		registry.add(entity, Collider{ 1 });
+		registry.add(entity, Faction{ Faction_Type::BULLET });
+	}
+
+	for (const auto& enemy : layout.enemies) {
+		std::shared_ptr<EnemyType> prototype = getEnemyPrototype(enemy.type);
+
+		const Entity entity = registry.create();
+		registry.add(entity, Transform{ enemy.position, prototype->getDimension() });
+		registry.add(entity, Velocity{ 0.0F, 0.0F, *prototype->movementSpeed, true });
+		registry.add(entity, Health{ enemy.healthCount, prototype->getEnemyScore() });
+		registry.add(entity, Sprite{ prototype->textureType->texture, 0.0 });
+		registry.add(entity, Collider{ prototype->getDamage() });
+		registry.add(entity, Faction{ Faction_Type::ENEMY });
+	}
+}
+
+// Same per-tick work GamePlaying::update does for these entities, plus the render list capture
+EcsBenchmark::FrameStats EcsBenchmark::runObjectGraph(const WorldSnapshot& layout, int frameCount) {
+	layout.apply();
+
+	RenderList renderList;
+	FrameStats stats = { 0.0, 0.0, 0 };
+
+	for (int frame = 0; frame < frameCount; frame++) {
+		const Uint64 frameStart = SDL_GetPerformanceCounter();
+		FrameArena::getThreadArena().reset();
+
+		InvokerPlaying::getInstance()->updatePlayers();
+
+		Bullet::bullets.erase(
+			std::remove_if(Bullet::bullets.begin(), Bullet::bullets.end(), [](const std::unique_ptr<Bullet>& bullet) {
+				return *bullet->remove;
+			}),
+			Bullet::bullets.end()
+		);
+
+		for (auto& bullet : Bullet::bullets) {
+			bullet->update();
+		}
+
+		WaveManager::getInstance()->update();
+		renderList.capture();
+
+		const double frameMs = getElapsedMs(frameStart);
+		stats.averageMs += frameMs;
+		stats.worstMs = std::max(stats.worstMs, frameMs);
+	}
+
+	stats.averageMs /= frameCount;
+	stats.entitiesLeft = InvokerPlaying::getInstance()->players.size() + Bullet::bullets.size() +
+		WaveManager::getInstance()->getEnemies().size();
+	return stats;
+}
+
+EcsBenchmark::FrameStats EcsBenchmark::runRegistry(const WorldSnapshot& layout, int frameCount) {
+	EntityRegistry registry;
+	EntitySystems systems;
+	std::vector<SpriteCommand> sprites;
+	JobSystem& jobSystem = *Game::getInstance()->getJobSystem();
+
+	fillRegistry(layout, registry);
+
+	FrameStats stats = { 0.0, 0.0, 0 };
+
+	for (int frame = 0; frame < frameCount; frame++) {
+		const Uint64 frameStart = SDL_GetPerformanceCounter();
+		FrameArena::getThreadArena().reset();
+
+		systems.movement(registry, jobSystem);
+		systems.collision(registry);
+		systems.damage(registry);
+		systems.render(registry, layout.backgroundSrcRect, sprites);
+
+		const double frameMs = getElapsedMs(frameStart);
+		stats.averageMs += frameMs;
+		stats.worstMs = std::max(stats.worstMs, frameMs);
+	}
+
+	stats.averageMs /= frameCount;
+	stats.entitiesLeft = registry.getAliveCount();
+	return stats;
+}
+
+void EcsBenchmark::printStats(const char* label, const FrameStats& stats) {
+	std::cout << "  " << label << ": avg " << stats.averageMs << " ms, worst " << stats.worstMs
+		<< " ms, " << stats.entitiesLeft << " entities left" << '\n';
+}
+
+void EcsBenchmark::run(size_t entityCount, int frameCount) {
+	if (frameCount <= 0) return;
+
+	WorldSnapshot layout;
+	buildLayout(layout, entityCount);
+
+	std::cout << "ECS benchmark: " << entityCount << " entities, " << frameCount << " frames, "
+		<< Game::getInstance()->getJobSystem()->getWorkerCount() << " workers" << '\n';
+
+	printStats("object graph", runObjectGraph(layout, frameCount));
+	printStats("registry    ", runRegistry(layout, frameCount));
+}
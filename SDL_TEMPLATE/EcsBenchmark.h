@@ -0,0 +1,33 @@
+#pragma once
+#include <SDL.h>
+
+struct WorldSnapshot;
+class EntityRegistry;
+
+// Runs the same seeded layout through the live object graph and through EntityRegistry + EntitySystems,
+// then prints per-frame cost for both. Needs Game::initAll for prototypes, textures and the world size.
+class EcsBenchmark {
+private:
+	constexpr static Uint32 LAYOUT_SEED = 1337;
+	constexpr static int BULLET_SHARE = 10; // One in this many entities is a bullet
+	constexpr static int BULLET_SPREAD = 600;
+
+	struct FrameStats {
+		double averageMs;
+		double worstMs;
+		size_t entitiesLeft;
+	};
+
+private:
+	static void buildLayout(WorldSnapshot& layout, size_t entityCount);
+	static void fillRegistry(const WorldSnapshot& layout, EntityRegistry& registry);
+	static FrameStats runObjectGraph(const WorldSnapshot& layout, int frameCount);
+	static FrameStats runRegistry(const WorldSnapshot& layout, int frameCount);
+	static void printStats(const char* label, const FrameStats& stats);
+
+public:
+	constexpr static size_t DEFAULT_ENTITY_COUNT = 1000;
+	constexpr static int DEFAULT_FRAME_COUNT = 600;
+
+	static void run(size_t entityCount, int frameCount);
+};
@@ -4,16 +4,18 @@
 #include "GameEnums.h"
 
 class Player;
+struct SpriteCommand;
+class SpatialGrid;
+class FlowField;
 
 class Enemy : public Prototype {
 public:
     virtual ~Enemy() = default;
     virtual int getEnemyScore() = 0;
-    virtual void undoMove() = 0;
-    virtual void checkCollision() = 0;
+    virtual void checkCollision(const SpatialGrid& enemyGrid, size_t selfIndex) = 0;
     virtual void initPos() = 0;
-    virtual void update() = 0;
-    virtual void render() const = 0;
+    virtual void update(const FlowField& flowField) = 0;
+    virtual void saveRenderState(SpriteCommand& sprite) const = 0;
     virtual const bool& isDead() const = 0;
     virtual const SDL_Point& getPosition() const = 0;
     virtual const SDL_Point& getDimension() const = 0;
@@ -22,4 +24,6 @@ public:
     virtual void decreaseHealth() = 0;
     virtual Prototype_Type getType() const = 0;
     virtual int getMinimapPixelSize() = 0;
+    virtual int getHealth() const = 0;
+    virtual void restoreState(const SDL_Point& position, int healthCount) = 0;
 };
\ No newline at end of file
@@ -0,0 +1,9 @@
+#pragma once
+
+// Compile-time stat policies applied once when a prototype is derived, so variants stay plain EnemyType data.
+// Each policy needs SPEED_SCALE, EXTRA_HEALTH and SCORE_BONUS.
+struct FastArchetype {
+	constexpr static float SPEED_SCALE = 3.0F;
+	constexpr static int EXTRA_HEALTH = 1;
+	constexpr static int SCORE_BONUS = 2;
+};
@@ -1,11 +1,12 @@
 #include "EnemyType.h"
 #include "TextureType.h"
-#include "InvokerPlaying.h"
 #include "GameEnums.h"
-#include "Background.h"
-#include "Game.h"
-#include "Player.h"
-#include "WaveManager.h"
+#include "World.h"
+#include "RenderList.h"
+#include "SpatialGrid.h"
+#include "FlowField.h"
+#include "GameRandom.h"
+#include <algorithm>
 #include <cmath>
 #include <random>
 
@@ -23,7 +24,8 @@ EnemyType::EnemyType(Prototype_Type enemyType, std::shared_ptr<TextureType> type
 	directionY(std::make_unique<float>(0.0F)),
 	dead(std::make_unique<bool>(false)),
 	inflicted(std::make_unique<bool>(false)),
-	minimapSize(std::make_unique<int>(minimapSize)) {}
+	minimapSize(std::make_unique<int>(minimapSize)),
+	spawnInTicks(std::make_unique<int>(0)) {}
 
 EnemyType::EnemyType(const EnemyType& other)
 	: enemyType(std::make_unique<Prototype_Type>(*other.enemyType)),
@@ -38,55 +40,29 @@ EnemyType::EnemyType(const EnemyType& other)
 	directionY(std::make_unique<float>(*other.directionY)),
 	dead(std::make_unique<bool>(*other.dead)),
 	inflicted(std::make_unique<bool>(*other.inflicted)) ,
-	minimapSize(std::make_unique<int>(*other.minimapSize)){}
-
-std::shared_ptr<Player> EnemyType::getNearestPlayer() {
-	std::shared_ptr<Player> nearestPlayer;
-	float nearestDistance = std::numeric_limits<float>::max();
-
-	for (auto& player : InvokerPlaying::getInstance()->players) {
-		float currentDistance = static_cast<float>(
-			(player.second->position->x - position->x) * (player.second->position->x - position->x) +
-			(player.second->position->y - position->y) * (player.second->position->y - position->y)
-			);
-
-		if (currentDistance < nearestDistance) {
-			nearestDistance = currentDistance;
-			nearestPlayer = player.second;
-		}
-	}
-
-	return nearestPlayer;
-}
-
-
-void EnemyType::calculateNormalizedLength(std::shared_ptr<Player> nearestPlayer) {
-	float dx = static_cast<float>(nearestPlayer->position->x + (Player::PLAYER_DIMENSION.x / 2)) - position->x + Background::getInstance()->srcRect->x;
-	float dy = static_cast<float>(nearestPlayer->position->y + (Player::PLAYER_DIMENSION.y / 2)) - position->y + Background::getInstance()->srcRect->y;
-
-	float distance = sqrt(dx * dx + dy * dy);
-
-	*directionX = static_cast<float>(dx) / distance;
-	*directionY = static_cast<float>(dy) / distance;
-}
+	minimapSize(std::make_unique<int>(*other.minimapSize)),
+	spawnInTicks(std::make_unique<int>(*other.spawnInTicks)) {}
 
 void EnemyType::move() {
 	position->x += static_cast<int>(*directionX * *movementSpeed);
 	position->y += static_cast<int>(*directionY * *movementSpeed);
 }
 
+void EnemyType::startSpawnIn() {
+	*spawnInTicks = SPAWN_IN_TICKS;
+}
+
 void EnemyType::initPos() {
-	static std::random_device dev;
-	static std::mt19937 rng(dev());
+	std::mt19937& rng = GameRandom::getEngine();
 
 	std::uniform_int_distribution<std::mt19937::result_type> distX(
 		BORDER_ALLOWANCE,
-		Background::getInstance()->getDimension().x - BORDER_ALLOWANCE - textureType->dimension.x
+		World::getInstance()->getDimension().x - BORDER_ALLOWANCE - textureType->dimension.x
 	);
 
 	std::uniform_int_distribution<std::mt19937::result_type> distY(
 		BORDER_ALLOWANCE,
-		Background::getInstance()->getDimension().y - BORDER_ALLOWANCE - textureType->dimension.y
+		World::getInstance()->getDimension().y - BORDER_ALLOWANCE - textureType->dimension.y
 	);
 
 	position->x = distX(rng);
@@ -97,66 +73,63 @@ int EnemyType::getEnemyScore() {
 	return *score;
 }
 
-void EnemyType::undoMove() {
-	position->x -= static_cast<int>(*directionX * *movementSpeed);
-	position->y -= static_cast<int>(*directionY * *movementSpeed);
-}
-
-void EnemyType::checkCollision() {
-	for (const auto& otherEnemy : WaveManager::getInstance()->getEnemies()) {
-		EnemyType* EnemyTypePtr = dynamic_cast<EnemyType*>(otherEnemy.get());
-		if (!EnemyTypePtr || otherEnemy == shared_from_this()) {
-			continue;
-		}
-
-		SDL_Point pos1 = *position;
-		SDL_Point pos2 = *EnemyTypePtr->position;
+// Only reads the grid snapshot and writes this enemy, so enemies can be checked in parallel
+void EnemyType::checkCollision(const SpatialGrid& enemyGrid, size_t selfIndex) {
+	float pushX;
+	float pushY;
+	enemyGrid.getSeparationPush(selfIndex, pushX, pushY);
 
-		if (pos1.x < pos2.x + dimension->x &&
-			pos1.x + dimension->x > pos2.x &&
-			pos1.y < pos2.y + dimension->y &&
-			pos1.y + dimension->y > pos2.y) {
-			undoMove();
-			undoMove();
-			undoMove();
-		}
-	}
+	const float pushLimit = std::max(*movementSpeed, 1.0F) * SEPARATION_PUSH_LIMIT;
+	position->x += static_cast<int>(std::lround(std::min(std::max(pushX, -pushLimit), pushLimit)));
+	position->y += static_cast<int>(std::lround(std::min(std::max(pushY, -pushLimit), pushLimit)));
 
 	if (position->x < static_cast<float>(BORDER_ALLOWANCE))
 		position->x = static_cast<int>(static_cast<float>(BORDER_ALLOWANCE));
 	if (position->x + dimension->x >
-		Background::getInstance()->getDimension().x - static_cast<float>(BORDER_ALLOWANCE))
-		position->x = static_cast<int>(Background::getInstance()->getDimension().x - 
+		World::getInstance()->getDimension().x - static_cast<float>(BORDER_ALLOWANCE))
+		position->x = static_cast<int>(World::getInstance()->getDimension().x - 
 			dimension->x - static_cast<float>(BORDER_ALLOWANCE));
 	if (position->y < static_cast<float>(BORDER_ALLOWANCE))
 		position->y = static_cast<int>(static_cast<float>(BORDER_ALLOWANCE));
 	if (position->y + dimension->y >
-		Background::getInstance()->getDimension().y - static_cast<float>(BORDER_ALLOWANCE))
-		position->y = static_cast<int>(Background::getInstance()->getDimension().y - 
+		World::getInstance()->getDimension().y - static_cast<float>(BORDER_ALLOWANCE))
+		position->y = static_cast<int>(World::getInstance()->getDimension().y - 
 			dimension->y - static_cast<float>(BORDER_ALLOWANCE));
 }
 
 
 
-void EnemyType::update() {
-	std::shared_ptr<Player> nearestPlayer = getNearestPlayer();
-	if (nearestPlayer) {
-		calculateNormalizedLength(nearestPlayer);
+void EnemyType::update(const FlowField& flowField) {
+	if (*spawnInTicks > 0) {
+		--*spawnInTicks;
+		return;
+	}
+
+	const SDL_Point center = { position->x + dimension->x / 2, position->y + dimension->y / 2 };
+
+	if (flowField.sampleDirection(center, *directionX, *directionY)) {
 		move();
 	}
 }
 
-void EnemyType::render() const {
-	SDL_Rect dstRect = { 
-		position->x - Background::getInstance()->srcRect->x,
-		position->y - Background::getInstance()->srcRect->y,
+void EnemyType::saveRenderState(SpriteCommand& sprite) const {
+	sprite.texture = textureType->texture;
+	sprite.dstRect = {
+		position->x - World::getInstance()->srcRect.x,
+		position->y - World::getInstance()->srcRect.y,
 		dimension->x,
 		dimension->y
 	};
-	
-	SDL_SetRenderTarget(Game::getInstance()->getRenderer(), Background::getInstance()->background);
-	SDL_RenderCopy(Game::getInstance()->getRenderer(), textureType->texture, nullptr, &dstRect);
-	SDL_SetRenderTarget(Game::getInstance()->getRenderer(), nullptr);
+	sprite.angle = 0.0;
+
+	// Grows from its center while spawning in
+	if (*spawnInTicks > 0) {
+		const float scale = 1.0F - static_cast<float>(*spawnInTicks) / (SPAWN_IN_TICKS + 1);
+		sprite.dstRect.w = static_cast<int>(dimension->x * scale);
+		sprite.dstRect.h = static_cast<int>(dimension->y * scale);
+		sprite.dstRect.x += (dimension->x - sprite.dstRect.w) / 2;
+		sprite.dstRect.y += (dimension->y - sprite.dstRect.h) / 2;
+	}
 }
 
 const bool& EnemyType::isDead() const {
@@ -196,3 +169,14 @@ const SDL_Point& EnemyType::getDimension() const {
 const int EnemyType::getDamage() const {
 	return *damage;
 }
+
+int EnemyType::getHealth() const {
+	return *healthCount;
+}
+
+void EnemyType::restoreState(const SDL_Point& position, int healthCount) {
+	*this->position = position;
+	*this->healthCount = healthCount;
+	*dead = false;
+	*spawnInTicks = 0;
+}
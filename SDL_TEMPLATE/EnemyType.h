@@ -6,8 +6,14 @@
 
 class Player;
 class TextureType;
+class SpatialGrid;
+class FlowField;
+
+class EnemyType final : public Enemy, public std::enable_shared_from_this<EnemyType> {
+private:
+	constexpr static float SEPARATION_PUSH_LIMIT = 2.0F; // Max push per tick, in multiples of the movement speed
+	constexpr static int SPAWN_IN_TICKS = 15;
 
-class EnemyType : public Enemy, public std::enable_shared_from_this<EnemyType> {
 public:
 	std::unique_ptr<Prototype_Type> enemyType;
 	std::shared_ptr<TextureType> textureType;
@@ -22,22 +28,33 @@ public:
 	std::unique_ptr<bool> dead;
 	std::unique_ptr<bool> inflicted;
 	std::unique_ptr<int> minimapSize;
+	std::unique_ptr<int> spawnInTicks; // Left of the spawn-in animation, the enemy holds still meanwhile
 
 private:
-	std::shared_ptr<Player> getNearestPlayer();
-	void calculateNormalizedLength(std::shared_ptr<Player> nearestPlayer);
 	void move();
 
 public:
 	EnemyType(Prototype_Type enemyType, std::shared_ptr<TextureType> type, SDL_Point dimension, int healthCount, float speed, int damage, int score, int minimampSize);
 	EnemyType(const EnemyType& other);
 
+	// Copies a base prototype with the archetype's stats baked in, no wrapper or per-update checks
+	template <typename Archetype>
+	static std::shared_ptr<EnemyType> createArchetype(const EnemyType& base, Prototype_Type archetypeType) {
+		std::shared_ptr<EnemyType> enemy = std::make_shared<EnemyType>(base);
+		*enemy->enemyType = archetypeType;
+		*enemy->movementSpeed *= Archetype::SPEED_SCALE;
+		*enemy->healthCount += Archetype::EXTRA_HEALTH;
+		*enemy->score += Archetype::SCORE_BONUS;
+		return enemy;
+	}
+
+	void startSpawnIn();
+
 	void initPos() override;
 	int getEnemyScore() override;
-	void undoMove() override;
-	void checkCollision() override;
-	void update() override;
-	void render() const override;
+	void checkCollision(const SpatialGrid& enemyGrid, size_t selfIndex) override;
+	void update(const FlowField& flowField) override;
+	void saveRenderState(SpriteCommand& sprite) const override;
 	std::shared_ptr<Prototype> clone() const override;
 	const bool& isDead() const override;
 	void setDead() override;
@@ -47,5 +64,7 @@ public:
 	Prototype_Type getType() const override;
 	int getMinimapPixelSize() override;
 	const int getDamage() const override;
+	int getHealth() const override;
+	void restoreState(const SDL_Point& position, int healthCount) override;
 };
 
@@ -0,0 +1,56 @@
+#include "EntityRegistry.h"
+
+EntityRegistry::EntityRegistry() : aliveCount(0) {}
+
+// Ids are recycled, systems must not hold on to an entity past the pass that destroyed it
+Entity EntityRegistry::create() {
+	Entity entity;
+
+	if (!freeEntities.empty()) {
+		entity = freeEntities.back();
+		freeEntities.pop_back();
+	} else {
+		entity = static_cast<Entity>(alive.size());
+		alive.push_back(false);
+	}
+
+	alive[entity] = true;
+	++aliveCount;
+	return entity;
+}
+
+void EntityRegistry::destroy(Entity entity) {
+	if (!isAlive(entity)) return;
+
+	getPool<Transform>().remove(entity);
+	getPool<Velocity>().remove(entity);
+	getPool<Health>().remove(entity);
+	getPool<Sprite>().remove(entity);
+	getPool<Collider>().remove(entity);
+	getPool<Faction>().remove(entity);
+
+	alive[entity] = false;
+	freeEntities.push_back(entity);
+	--aliveCount;
+}
+
+void EntityRegistry::clear() {
+	getPool<Transform>().clear();
+	getPool<Velocity>().clear();
+	getPool<Health>().clear();
+	getPool<Sprite>().clear();
+	getPool<Collider>().clear();
+	getPool<Faction>().clear();
+
+	alive.clear();
+	freeEntities.clear();
+	aliveCount = 0;
+}
+
+bool EntityRegistry::isAlive(Entity entity) const {
+	return entity < alive.size() && alive[entity];
+}
+
+size_t EntityRegistry::getAliveCount() const {
+	return aliveCount;
+}
@@ -0,0 +1,122 @@
+#pragma once
+#include <SDL.h>
+#include <tuple>
+#include <vector>
+#include "Components.h"
+
+using Entity = Uint32;
+
+// Sparse set: components are packed in a dense array, the sparse array maps entity to dense slot
+template <typename Component>
+class ComponentPool {
+private:
+	enum : int { EMPTY_SLOT = -1 };
+
+	std::vector<int> sparse;
+	std::vector<Entity> entities;
+	std::vector<Component> components;
+
+public:
+	void add(Entity entity, const Component& component) {
+		if (entity >= sparse.size()) sparse.resize(entity + 1, EMPTY_SLOT);
+
+		if (sparse[entity] != EMPTY_SLOT) {
+			components[sparse[entity]] = component;
+			return;
+		}
+
+		sparse[entity] = static_cast<int>(entities.size());
+		entities.push_back(entity);
+		components.push_back(component);
+	}
+
+	// Swap-and-pop keeps the arrays dense, so the removed slot gets the last entity
+	void remove(Entity entity) {
+		if (!has(entity)) return;
+
+		const int slot = sparse[entity];
+		const Entity last = entities.back();
+
+		entities[slot] = last;
+		components[slot] = components.back();
+		sparse[last] = slot;
+
+		entities.pop_back();
+		components.pop_back();
+		sparse[entity] = EMPTY_SLOT;
+	}
+
+	bool has(Entity entity) const {
+		return entity < sparse.size() && sparse[entity] != EMPTY_SLOT;
+	}
+
+	Component& get(Entity entity) {
+		return components[sparse[entity]];
+	}
+
+	const Component& get(Entity entity) const {
+		return components[sparse[entity]];
+	}
+
+	size_t size() const {
+		return entities.size();
+	}
+
+	Entity getEntity(size_t slot) const {
+		return entities[slot];
+	}
+
+	Component& getAt(size_t slot) {
+		return components[slot];
+	}
+
+	void clear() {
+		sparse.clear();
+		entities.clear();
+		components.clear();
+	}
+};
+
+class EntityRegistry {
+private:
+	std::tuple<
+		ComponentPool<Transform>,
+		ComponentPool<Velocity>,
+		ComponentPool<Health>,
+		ComponentPool<Sprite>,
+		ComponentPool<Collider>,
+		ComponentPool<Faction>> pools;
+	std::vector<bool> alive;
+	std::vector<Entity> freeEntities;
+	size_t aliveCount;
+
+public:
+	EntityRegistry();
+
+	Entity create();
+	void destroy(Entity entity); // Ignores entities that are already destroyed
+	void clear();
+
+	bool isAlive(Entity entity) const;
+	size_t getAliveCount() const;
+
+	template <typename Component>
+	ComponentPool<Component>& getPool() {
+		return std::get<ComponentPool<Component>>(pools);
+	}
+
+	template <typename Component>
+	void add(Entity entity, const Component& component) {
+		getPool<Component>().add(entity, component);
+	}
+
+	template <typename Component>
+	Component& get(Entity entity) {
+		return getPool<Component>().get(entity);
+	}
+
+	template <typename Component>
+	bool has(Entity entity) {
+		return getPool<Component>().has(entity);
+	}
+};
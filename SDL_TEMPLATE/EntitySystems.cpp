@@ -0,0 +1,199 @@
+#include "EntitySystems.h"
+#include "World.h"
+#include "GameEnums.h"
+#include "JobSystem.h"
+#include "RenderList.h"
+#include <cmath>
+
+namespace {
+	SDL_Rect getRect(const Transform& transform) {
+		return { transform.position.x, transform.position.y, transform.dimension.x, transform.dimension.y };
+	}
+
+	SDL_Point getCenter(const Transform& transform) {
+		return { transform.position.x + transform.dimension.x / 2, transform.position.y + transform.dimension.y / 2 };
+	}
+}
+
+EntitySystems::EntitySystems() : ticksUntilFlowFieldRebuild(0) {}
+
+// Crowd costs come from last tick's enemy bounds, same as WaveManager
+void EntitySystems::rebuildFlowField(EntityRegistry& registry) {
+	auto& factions = registry.getPool<Faction>();
+	FrameVector<SDL_Point> sources;
+
+	for (size_t slot = 0; slot < factions.size(); slot++) {
+		if (factions.getAt(slot).type != Faction_Type::PLAYER) continue;
+
+		const Entity entity = factions.getEntity(slot);
+		if (registry.get<Health>(entity).current <= 0) continue;
+
+		sources.push_back(getCenter(registry.get<Transform>(entity)));
+	}
+
+	flowField.build(sources, enemyBounds, World::getInstance()->getDimension());
+}
+
+void EntitySystems::movement(EntityRegistry& registry, JobSystem& jobSystem) {
+	if (ticksUntilFlowFieldRebuild-- <= 0) {
+		rebuildFlowField(registry);
+		ticksUntilFlowFieldRebuild = FLOW_FIELD_INTERVAL_TICKS - 1;
+	}
+
+	auto& velocities = registry.getPool<Velocity>();
+	auto& transforms = registry.getPool<Transform>();
+
+	// Each slot only writes its own velocity and transform
+	jobSystem.parallelFor(velocities.size(), MOVEMENT_CHUNK_SIZE, [&](size_t begin, size_t end, size_t) {
+		for (size_t slot = begin; slot < end; slot++) {
+			Velocity& velocity = velocities.getAt(slot);
+			Transform& transform = transforms.get(velocities.getEntity(slot));
+
+			if (velocity.steered && !flowField.sampleDirection(getCenter(transform), velocity.directionX, velocity.directionY)) continue;
+
+			transform.position.x += static_cast<int>(velocity.directionX * velocity.speed);
+			transform.position.y += static_cast<int>(velocity.directionY * velocity.speed);
+		}
+	});
+}
+
+void EntitySystems::separateEnemies(EntityRegistry& registry) {
+	const SDL_Point& worldDimension = World::getInstance()->getDimension();
+
+	for (size_t index = 0; index < enemyEntities.size(); index++) {
+		Transform& transform = registry.get<Transform>(enemyEntities[index]);
+		const float speed = registry.get<Velocity>(enemyEntities[index]).speed;
+
+		float pushX;
+		float pushY;
+		enemyGrid.getSeparationPush(index, pushX, pushY);
+
+		const float pushLimit = (speed > 1.0F ? speed : 1.0F) * SEPARATION_PUSH_LIMIT;
+		pushX = pushX > pushLimit ? pushLimit : (pushX < -pushLimit ? -pushLimit : pushX);
+		pushY = pushY > pushLimit ? pushLimit : (pushY < -pushLimit ? -pushLimit : pushY);
+
+		SDL_Point& position = transform.position;
+		position.x += static_cast<int>(std::lround(pushX));
+		position.y += static_cast<int>(std::lround(pushY));
+
+		if (position.x < BORDER_ALLOWANCE) position.x = BORDER_ALLOWANCE;
+		if (position.y < BORDER_ALLOWANCE) position.y = BORDER_ALLOWANCE;
+		if (position.x + transform.dimension.x > worldDimension.x - BORDER_ALLOWANCE)
+			position.x = worldDimension.x - BORDER_ALLOWANCE - transform.dimension.x;
+		if (position.y + transform.dimension.y > worldDimension.y - BORDER_ALLOWANCE)
+			position.y = worldDimension.y - BORDER_ALLOWANCE - transform.dimension.y;
+	}
+}
+
+void EntitySystems::collision(EntityRegistry& registry) {
+	auto& factions = registry.getPool<Faction>();
+	const SDL_Point& worldDimension = World::getInstance()->getDimension();
+
+	enemyEntities.clear();
+	enemyBounds.clear();
+	int largestQuery = 0;
+
+	for (size_t slot = 0; slot < factions.size(); slot++) {
+		const Entity entity = factions.getEntity(slot);
+		const Transform& transform = registry.get<Transform>(entity);
+
+		if (factions.getAt(slot).type == Faction_Type::ENEMY) {
+			enemyEntities.push_back(entity);
+			enemyBounds.push_back(getRect(transform));
+		} else {
+			if (transform.dimension.x > largestQuery) largestQuery = transform.dimension.x;
+			if (transform.dimension.y > largestQuery) largestQuery = transform.dimension.y;
+		}
+	}
+
+	enemyGrid.build(enemyBounds, worldDimension, largestQuery);
+
+	// Bullets and players test against the same pre-separation bounds the enemies push apart with
+	for (size_t slot = 0; slot < factions.size(); slot++) {
+		const Faction_Type type = factions.getAt(slot).type;
+		if (type == Faction_Type::ENEMY) continue;
+
+		const Entity entity = factions.getEntity(slot);
+		const Transform& transform = registry.get<Transform>(entity);
+		const SDL_Rect rect = getRect(transform);
+
+		if (type == Faction_Type::BULLET) {
+			if (rect.x < BORDER_ALLOWANCE || rect.y < BORDER_ALLOWANCE ||
+				rect.x + rect.w > worldDimension.x - BORDER_ALLOWANCE ||
+				rect.y + rect.h > worldDimension.y - BORDER_ALLOWANCE) {
+				expiredEntities.push_back(entity);
+				continue;
+			}
+
+			const int bulletDamage = registry.get<Collider>(entity).contactDamage;
+			bool hit = false;
+
+			enemyGrid.forEachNear(getCenter(transform), [&](size_t enemyIndex) {
+				if (!SDL_HasIntersection(&rect, &enemyBounds[enemyIndex])) return;
+
+				damageEvents.push_back({ enemyEntities[enemyIndex], bulletDamage });
+				hit = true;
+			});
+
+			if (hit) expiredEntities.push_back(entity);
+		} else if (registry.get<Health>(entity).current > 0) {
+			enemyGrid.forEachNear(getCenter(transform), [&](size_t enemyIndex) {
+				if (!SDL_HasIntersection(&rect, &enemyBounds[enemyIndex])) return;
+
+				const Entity enemy = enemyEntities[enemyIndex];
+				damageEvents.push_back({ entity, registry.get<Collider>(enemy).contactDamage });
+				damageEvents.push_back({ enemy, registry.get<Health>(enemy).current });
+			});
+		}
+	}
+
+	separateEnemies(registry);
+}
+
+int EntitySystems::damage(EntityRegistry& registry) {
+	int score = 0;
+
+	for (const auto& event : damageEvents) {
+		if (!registry.isAlive(event.target)) continue;
+
+		Health& health = registry.get<Health>(event.target);
+		if (health.current <= 0) continue;
+
+		health.current -= event.amount;
+		if (health.current > 0) continue;
+
+		score += health.score;
+
+		// Dead players stay in the world, like the object graph
+		if (registry.get<Faction>(event.target).type != Faction_Type::PLAYER) expiredEntities.push_back(event.target);
+	}
+
+	for (const auto& entity : expiredEntities) {
+		registry.destroy(entity);
+	}
+
+	damageEvents.clear();
+	expiredEntities.clear();
+	return score;
+}
+
+void EntitySystems::render(EntityRegistry& registry, const SDL_Rect& camera, std::vector<SpriteCommand>& sprites) {
+	auto& spritePool = registry.getPool<Sprite>();
+	sprites.clear();
+
+	for (size_t slot = 0; slot < spritePool.size(); slot++) {
+		const Sprite& sprite = spritePool.getAt(slot);
+		const Transform& transform = registry.get<Transform>(spritePool.getEntity(slot));
+
+		SpriteCommand command;
+		command.texture = sprite.texture;
+		command.dstRect = {
+			transform.position.x - camera.x,
+			transform.position.y - camera.y,
+			transform.dimension.x,
+			transform.dimension.y
+		};
+		command.angle = sprite.angle;
+		sprites.push_back(command);
+	}
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <SDL.h>
+#include <vector>
+#include "EntityRegistry.h"
+#include "SpatialGrid.h"
+#include "FlowField.h"
+
+class JobSystem;
+struct SpriteCommand;
+
+struct DamageEvent {
+	Entity target;
+	int amount;
+};
+
+// Movement, collision, damage and render passes over an EntityRegistry, run in that order once per tick.
+// Collision only queues damage, so every pass either reads or writes a given component array, never both across entities.
+class EntitySystems {
+private:
+	constexpr static size_t MOVEMENT_CHUNK_SIZE = 128;
+	constexpr static int FLOW_FIELD_INTERVAL_TICKS = 3;
+	constexpr static float SEPARATION_PUSH_LIMIT = 2.0F;
+
+	FlowField flowField;
+	int ticksUntilFlowFieldRebuild;
+	SpatialGrid enemyGrid;
+	std::vector<SDL_Rect> enemyBounds;
+	std::vector<Entity> enemyEntities;
+	std::vector<DamageEvent> damageEvents;
+	std::vector<Entity> expiredEntities;
+
+private:
+	void rebuildFlowField(EntityRegistry& registry);
+	void separateEnemies(EntityRegistry& registry);
+
+public:
+	EntitySystems();
+
+	void movement(EntityRegistry& registry, JobSystem& jobSystem);
+	void collision(EntityRegistry& registry);
+	int damage(EntityRegistry& registry); // Returns the score earned this tick
+	void render(EntityRegistry& registry, const SDL_Rect& camera, std::vector<SpriteCommand>& sprites);
+};
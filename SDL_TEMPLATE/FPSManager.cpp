@@ -1,26 +1,121 @@
 #include "FPSManager.h"
-#include <iostream>
+#include "GameClock.h"
+#include "Logger.h"
+#include <cmath>
 
-void FPSManager::calculateAverageFPS(int& countFrame, Uint32& startTime) {
-    ++countFrame;
+FPSManager::FPSManager() : uncapped(false), frameNs(GameClock::NANOSECONDS_PER_SECOND / TARGET_FPS), deadlineNs(0),
+                           lastFrameEndNs(0), overshootEstimateNs(INITIAL_OVERSHOOT_NS), window(), session(),
+                           windowStartNs(0), stats() {
+    stats.sleepOvershootMs = static_cast<double>(overshootEstimateNs) / GameClock::NANOSECONDS_PER_MILLISECOND;
+}
 
-    constexpr Uint16 ONE_SECOND_IN_MS = 1000;
-    Uint32 currentTime = SDL_GetTicks();
+FPSManager* FPSManager::getInstance() {
+    static FPSManager instance;
+    return &instance;
+}
 
-    if (currentTime - startTime > ONE_SECOND_IN_MS) {
-        float fps = countFrame / ((currentTime - startTime) / static_cast<float>(ONE_SECOND_IN_MS));
-        countFrame = 0;
-        startTime = currentTime;
-    }
+void FPSManager::setUncapped(bool uncapped) {
+    this->uncapped = uncapped;
+}
+
+bool FPSManager::isUncapped() const {
+    return uncapped;
+}
+
+void FPSManager::addSample(FrameStatistics& statistics, Uint64 sampleNs) {
+    const double sample = static_cast<double>(sampleNs);
+    const double delta = sample - statistics.meanNs;
+
+    statistics.frames++;
+    statistics.meanNs += delta / statistics.frames;
+    statistics.squaredDeviationNs += delta * (sample - statistics.meanNs);
+    if (sampleNs > statistics.worstNs) statistics.worstNs = sampleNs;
+}
+
+double FPSManager::getStdDevNs(const FrameStatistics& statistics) {
+    if (statistics.frames < 2) return 0.0;
+    return std::sqrt(statistics.squaredDeviationNs / statistics.frames);
 }
 
-void FPSManager::limitFPS(const Uint32& frameStart) {
-    constexpr Uint8 FPS = 60; 
-    constexpr Uint32 FRAME_DURATION = static_cast<Uint32>(1000.0F / FPS); 
+void FPSManager::updateOvershoot(Uint64 overshootNs) {
+    if (overshootNs > MAX_OVERSHOOT_NS) overshootNs = MAX_OVERSHOOT_NS;
+
+    if (overshootNs > overshootEstimateNs) overshootEstimateNs = overshootNs;
+    else overshootEstimateNs -= (overshootEstimateNs - overshootNs) / OVERSHOOT_DECAY;
+}
+
+void FPSManager::sleepUntil(Uint64 targetNs) {
+    Uint64 nowNs = GameClock::getRealTimeNs();
+    if (nowNs >= targetNs) return;
+
+    // Coarse sleep in whole milliseconds, ending the expected overshoot before the deadline
+    const Uint64 remainingNs = targetNs - nowNs;
+    if (remainingNs > overshootEstimateNs + GameClock::NANOSECONDS_PER_MILLISECOND) {
+        const Uint32 requestedMs = static_cast<Uint32>((remainingNs - overshootEstimateNs) / GameClock::NANOSECONDS_PER_MILLISECOND);
+        const Uint64 requestedNs = requestedMs * GameClock::NANOSECONDS_PER_MILLISECOND;
 
-    Uint32 frameDuration = SDL_GetTicks() - frameStart;
+        SDL_Delay(requestedMs);
 
-    if (frameDuration < FRAME_DURATION) {
-        SDL_Delay(FRAME_DURATION - frameDuration); 
+        const Uint64 wokeNs = GameClock::getRealTimeNs();
+        updateOvershoot(wokeNs - nowNs > requestedNs ? wokeNs - nowNs - requestedNs : 0);
+        nowNs = wokeNs;
     }
-}
\ No newline at end of file
+
+    // The rest is spun on the performance counter
+    while (nowNs < targetNs) {
+        nowNs = GameClock::getRealTimeNs();
+    }
+}
+
+void FPSManager::recordFrame(Uint64 nowNs, Uint64 intervalNs) {
+    addSample(window, intervalNs);
+    addSample(session, intervalNs);
+
+    if (windowStartNs == 0) windowStartNs = nowNs - intervalNs;
+    if (nowNs - windowStartNs < REPORT_INTERVAL_NS) return;
+
+    const double msPerNs = 1.0 / GameClock::NANOSECONDS_PER_MILLISECOND;
+
+    stats.averageFps = window.frames * static_cast<double>(GameClock::NANOSECONDS_PER_SECOND) / (nowNs - windowStartNs);
+    stats.meanFrameMs = window.meanNs * msPerNs;
+    stats.frameStdDevMs = getStdDevNs(window) * msPerNs;
+    stats.worstFrameMs = window.worstNs * msPerNs;
+    stats.sleepOvershootMs = overshootEstimateNs * msPerNs;
+
+    window = FrameStatistics();
+    windowStartNs = nowNs;
+}
+
+void FPSManager::limitFPS() {
+    if (!uncapped && deadlineNs != 0) sleepUntil(deadlineNs);
+
+    const Uint64 nowNs = GameClock::getRealTimeNs();
+
+    if (lastFrameEndNs != 0) recordFrame(nowNs, nowNs - lastFrameEndNs);
+    lastFrameEndNs = nowNs;
+
+    // A frame that ran more than a whole frame late resynchronizes instead of rushing the next ones to catch up
+    if (deadlineNs == 0 || nowNs >= deadlineNs + frameNs) deadlineNs = nowNs + frameNs;
+    else deadlineNs += frameNs;
+}
+
+void FPSManager::restartPacing() {
+    deadlineNs = 0;
+    lastFrameEndNs = 0;
+    windowStartNs = 0;
+    window = FrameStatistics();
+}
+
+const FramePacingStats& FPSManager::getStats() const {
+    return stats;
+}
+
+void FPSManager::logSessionReport() const {
+    if (session.frames == 0) return;
+
+    const double msPerNs = 1.0 / GameClock::NANOSECONDS_PER_MILLISECOND;
+
+    LOG_INFO("Frame pacing over %llu frames%s: mean %.3f ms, std dev %.3f ms, worst %.3f ms, sleep overshoot %.3f ms",
+        static_cast<unsigned long long>(session.frames), uncapped ? " (uncapped)" : "", session.meanNs * msPerNs,
+        getStdDevNs(session) * msPerNs, session.worstNs * msPerNs, overshootEstimateNs * msPerNs);
+}
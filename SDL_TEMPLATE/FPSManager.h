@@ -1,9 +1,73 @@
 #pragma once
 #include <SDL.h>
 
+struct FramePacingStats {
+	double averageFps;
+	double meanFrameMs;
+	double frameStdDevMs; // Frame-to-frame jitter, a steady 60 FPS keeps it near zero
+	double worstFrameMs;
+	double sleepOvershootMs; // How late SDL_Delay is currently expected to wake up
+};
+
+// Paces the main loop to TARGET_FPS against a running deadline. SDL_Delay can wake a whole scheduler quantum late,
+// so the pacer sleeps until the measured overshoot before the deadline and spins on the performance counter for
+// the rest. Uncapped mode neither sleeps nor waits for vsync, for measuring what a frame really costs.
 class FPSManager {
+private:
+	FPSManager();
+
 public:
-	static void calculateAverageFPS(int& countFrame, Uint32& startTime);
-	static void limitFPS(const Uint32& frameStart);
-};
+	FPSManager(const FPSManager&) = delete;
+	FPSManager& operator=(const FPSManager&) = delete;
+	FPSManager(FPSManager&&) = delete;
+	FPSManager& operator=(FPSManager&&) = delete;
+
+	static FPSManager* getInstance();
+
+private:
+	constexpr static Uint64 TARGET_FPS = 60;
+	constexpr static Uint64 INITIAL_OVERSHOOT_NS = 2000000;
+	constexpr static Uint64 MAX_OVERSHOOT_NS = 20000000;
+	constexpr static Uint64 OVERSHOOT_DECAY = 16; // A late wake-up raises the estimate at once, earlier ones lower it by 1/16 of the gap
+	constexpr static Uint64 REPORT_INTERVAL_NS = 1000000000;
+
+	struct FrameStatistics {
+		Uint64 frames;
+		double meanNs;
+		double squaredDeviationNs; // Welford's running sum, variance is this over frames
+		Uint64 worstNs;
+	};
+
+	bool uncapped;
+	Uint64 frameNs;
+	Uint64 deadlineNs; // 0 until the first frame, or after the loop slept on its own
+	Uint64 lastFrameEndNs;
+	Uint64 overshootEstimateNs;
 
+	FrameStatistics window;
+	FrameStatistics session;
+	Uint64 windowStartNs;
+	FramePacingStats stats;
+
+private:
+	static void addSample(FrameStatistics& statistics, Uint64 sampleNs);
+	static double getStdDevNs(const FrameStatistics& statistics);
+
+	void sleepUntil(Uint64 targetNs);
+	void updateOvershoot(Uint64 overshootNs);
+	void recordFrame(Uint64 nowNs, Uint64 intervalNs);
+
+public:
+	// Must be called before Game::initAll, the renderer is created without vsync when uncapped
+	void setUncapped(bool uncapped);
+	bool isUncapped() const;
+
+	// Called at the end of every frame, returns when the next one is due
+	void limitFPS();
+
+	// The next frame starts a new interval, for a loop that just slept on the event queue
+	void restartPacing();
+
+	const FramePacingStats& getStats() const; // Last finished report interval
+	void logSessionReport() const;
+};
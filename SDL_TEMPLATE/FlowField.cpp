@@ -0,0 +1,160 @@
+#include "FlowField.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <utility>
+
+namespace {
+	constexpr int NEIGHBOR_COUNT = 8;
+	constexpr int NEIGHBOR_X[NEIGHBOR_COUNT] = { -1, 0, 1, -1, 1, -1, 0, 1 };
+	constexpr int NEIGHBOR_Y[NEIGHBOR_COUNT] = { -1, -1, -1, 0, 0, 1, 1, 1 };
+}
+
+FlowField::FlowField() : columns(0), rows(0), hasSources(false) {}
+
+int FlowField::getCellIndex(const SDL_Point& worldPosition) const {
+	const int column = std::min(std::max(worldPosition.x / CELL_SIZE, 0), columns - 1);
+	const int row = std::min(std::max(worldPosition.y / CELL_SIZE, 0), rows - 1);
+	return row * columns + column;
+}
+
+SDL_Point FlowField::getCellCenter(int cellIndex) const {
+	return { (cellIndex % columns) * CELL_SIZE + CELL_SIZE / 2, (cellIndex / columns) * CELL_SIZE + CELL_SIZE / 2 };
+}
+
+void FlowField::reset(const SDL_Point& worldDimension) {
+	columns = std::max(1, (worldDimension.x + CELL_SIZE - 1) / CELL_SIZE);
+	rows = std::max(1, (worldDimension.y + CELL_SIZE - 1) / CELL_SIZE);
+	cells.resize(columns * rows);
+
+	for (auto& cell : cells) {
+		cell.cost = UNREACHED;
+		cell.crowdCost = 0;
+		cell.directionX = 0.0F;
+		cell.directionY = 0.0F;
+		cell.steerDirect = false;
+		cell.target = { 0, 0 };
+	}
+}
+
+void FlowField::accumulateCrowd(const std::vector<SDL_Rect>& crowd) {
+	for (const auto& rect : crowd) {
+		Cell& cell = cells[getCellIndex({ rect.x + rect.w / 2, rect.y + rect.h / 2 })];
+		cell.crowdCost += CROWD_COST;
+		if (cell.crowdCost > MAX_CROWD_COST) cell.crowdCost = MAX_CROWD_COST;
+	}
+}
+
+void FlowField::propagate(const FrameVector<SDL_Point>& sources) {
+	using QueueEntry = std::pair<int, int>; // Cost, cell
+	std::priority_queue<QueueEntry, FrameVector<QueueEntry>, std::greater<QueueEntry>> open;
+
+	for (const auto& source : sources) {
+		const int cellIndex = getCellIndex(source);
+		if (cells[cellIndex].cost == 0) continue;
+
+		cells[cellIndex].cost = 0;
+		cells[cellIndex].target = source;
+		open.push({ 0, cellIndex });
+	}
+
+	while (!open.empty()) {
+		const QueueEntry entry = open.top();
+		open.pop();
+
+		const Cell& current = cells[entry.second];
+		if (entry.first > current.cost) continue;
+
+		const int column = entry.second % columns;
+		const int row = entry.second / columns;
+
+		for (int neighbor = 0; neighbor < NEIGHBOR_COUNT; neighbor++) {
+			const int neighborColumn = column + NEIGHBOR_X[neighbor];
+			const int neighborRow = row + NEIGHBOR_Y[neighbor];
+			if (neighborColumn < 0 || neighborColumn >= columns || neighborRow < 0 || neighborRow >= rows) continue;
+
+			Cell& next = cells[neighborRow * columns + neighborColumn];
+			const int stepCost = (NEIGHBOR_X[neighbor] != 0 && NEIGHBOR_Y[neighbor] != 0) ? DIAGONAL_COST : STRAIGHT_COST;
+			const int cost = current.cost + stepCost + next.crowdCost;
+
+			if (next.cost == UNREACHED || cost < next.cost) {
+				next.cost = cost;
+				next.target = current.target;
+				open.push({ cost, neighborRow * columns + neighborColumn });
+			}
+		}
+	}
+}
+
+void FlowField::buildDirections() {
+	for (int cellIndex = 0; cellIndex < static_cast<int>(cells.size()); cellIndex++) {
+		Cell& cell = cells[cellIndex];
+		if (cell.cost == UNREACHED) continue;
+
+		// Cells this close to a player aim straight at it for the final approach
+		if (cell.cost <= DIAGONAL_COST + MAX_CROWD_COST) {
+			cell.steerDirect = true;
+			continue;
+		}
+
+		const int column = cellIndex % columns;
+		const int row = cellIndex / columns;
+
+		auto costAt = [&](int neighborColumn, int neighborRow) {
+			if (neighborColumn < 0 || neighborColumn >= columns || neighborRow < 0 || neighborRow >= rows) return cell.cost;
+
+			const int cost = cells[neighborRow * columns + neighborColumn].cost;
+			return cost == UNREACHED ? cell.cost : cost;
+		};
+
+		// Central differences give a smooth direction instead of snapping to one of eight neighbors
+		float gradientX = static_cast<float>(costAt(column - 1, row) - costAt(column + 1, row));
+		float gradientY = static_cast<float>(costAt(column, row - 1) - costAt(column, row + 1));
+		float length = std::sqrt(gradientX * gradientX + gradientY * gradientY);
+
+		if (length == 0.0F) {
+			const SDL_Point center = getCellCenter(cellIndex);
+			gradientX = static_cast<float>(cell.target.x - center.x);
+			gradientY = static_cast<float>(cell.target.y - center.y);
+			length = std::sqrt(gradientX * gradientX + gradientY * gradientY);
+		}
+
+		if (length != 0.0F) {
+			cell.directionX = gradientX / length;
+			cell.directionY = gradientY / length;
+		}
+	}
+}
+
+void FlowField::build(const FrameVector<SDL_Point>& sources, const std::vector<SDL_Rect>& crowd, const SDL_Point& worldDimension) {
+	reset(worldDimension);
+
+	hasSources = !sources.empty();
+	if (!hasSources) return;
+
+	accumulateCrowd(crowd);
+	propagate(sources);
+	buildDirections();
+}
+
+bool FlowField::sampleDirection(const SDL_Point& worldPosition, float& directionX, float& directionY) const {
+	if (!hasSources) return false;
+
+	const Cell& cell = cells[getCellIndex(worldPosition)];
+	if (cell.cost == UNREACHED) return false;
+
+	if (!cell.steerDirect) {
+		directionX = cell.directionX;
+		directionY = cell.directionY;
+		return true;
+	}
+
+	const float dx = static_cast<float>(cell.target.x - worldPosition.x);
+	const float dy = static_cast<float>(cell.target.y - worldPosition.y);
+	const float distance = std::sqrt(dx * dx + dy * dy);
+
+	directionX = distance != 0.0F ? dx / distance : 0.0F;
+	directionY = distance != 0.0F ? dy / distance : 0.0F;
+	return true;
+}
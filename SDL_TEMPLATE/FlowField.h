@@ -0,0 +1,46 @@
+#pragma once
+#include <SDL.h>
+#include <vector>
+#include "FrameArena.h"
+
+// Coarse grid over the Background world where every cell points one step closer to the nearest alive player.
+// Built with a multi-source Dijkstra, so steering cost no longer depends on the player count.
+class FlowField {
+private:
+	constexpr static int CELL_SIZE = 48;
+	constexpr static int STRAIGHT_COST = 10;
+	constexpr static int DIAGONAL_COST = 14;
+	constexpr static int CROWD_COST = 3; // Extra cost per enemy already in a cell, spreads crowds over parallel lanes
+	constexpr static int MAX_CROWD_COST = 30;
+	constexpr static int UNREACHED = -1;
+
+	struct Cell {
+		int cost;
+		int crowdCost;
+		float directionX;
+		float directionY;
+		bool steerDirect; // Close enough to a player to aim at its position instead of the next cell
+		SDL_Point target;
+	};
+
+	std::vector<Cell> cells;
+	int columns;
+	int rows;
+	bool hasSources;
+
+private:
+	int getCellIndex(const SDL_Point& worldPosition) const;
+	SDL_Point getCellCenter(int cellIndex) const;
+	void reset(const SDL_Point& worldDimension);
+	void accumulateCrowd(const std::vector<SDL_Rect>& crowd);
+	void propagate(const FrameVector<SDL_Point>& sources);
+	void buildDirections();
+
+public:
+	FlowField();
+
+	void build(const FrameVector<SDL_Point>& sources, const std::vector<SDL_Rect>& crowd, const SDL_Point& worldDimension);
+
+	// Returns false when no player is reachable, the direction is left untouched then
+	bool sampleDirection(const SDL_Point& worldPosition, float& directionX, float& directionY) const;
+};
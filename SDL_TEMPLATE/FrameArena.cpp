@@ -0,0 +1,61 @@
+#include "FrameArena.h"
+
+FrameArena::FrameArena() : blockIndex(0), offset(0), usedBytes(0), peakBytes(0) {
+	addBlock(INITIAL_CAPACITY);
+}
+
+FrameArena& FrameArena::getThreadArena() {
+	static thread_local FrameArena arena;
+	return arena;
+}
+
+void FrameArena::addBlock(size_t minimumSize) {
+	size_t size = blocks.empty() ? INITIAL_CAPACITY : blocks.back().size * 2;
+	if (size < minimumSize) size = minimumSize;
+
+	blocks.push_back({ std::unique_ptr<unsigned char[]>(new unsigned char[size]), size });
+}
+
+void* FrameArena::allocate(size_t bytes, size_t alignment) {
+	while (true) {
+		Block& block = blocks[blockIndex];
+		const size_t alignedOffset = (offset + alignment - 1) & ~(alignment - 1);
+
+		if (alignedOffset + bytes <= block.size) {
+			usedBytes += alignedOffset + bytes - offset;
+			offset = alignedOffset + bytes;
+			return block.memory.get() + alignedOffset;
+		}
+
+		// Move on to the next block, growing the arena when this frame needs more than ever before
+		if (blockIndex + 1 == blocks.size()) addBlock(bytes + alignment);
+		++blockIndex;
+		offset = 0;
+	}
+}
+
+void FrameArena::reset() {
+	if (usedBytes > peakBytes) peakBytes = usedBytes;
+
+	if (blocks.size() > 1) {
+		size_t totalSize = 0;
+		for (const auto& block : blocks) {
+			totalSize += block.size;
+		}
+
+		blocks.clear();
+		addBlock(totalSize);
+	}
+
+	blockIndex = 0;
+	offset = 0;
+	usedBytes = 0;
+}
+
+size_t FrameArena::getUsedBytes() const {
+	return usedBytes;
+}
+
+size_t FrameArena::getPeakBytes() const {
+	return peakBytes > usedBytes ? peakBytes : usedBytes;
+}
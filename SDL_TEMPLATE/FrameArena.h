@@ -0,0 +1,80 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Linear allocator for temporaries that die within one frame. Every thread has its own arena.
+// The main loop resets the main thread's arena and SimulationThread resets its own before each tick.
+// Once the arena has grown to a frame's peak it never touches the heap again.
+class FrameArena {
+private:
+	constexpr static size_t INITIAL_CAPACITY = 64 * 1024;
+
+	struct Block {
+		std::unique_ptr<unsigned char[]> memory;
+		size_t size;
+	};
+
+	std::vector<Block> blocks;
+	size_t blockIndex;
+	size_t offset;
+	size_t usedBytes;
+	size_t peakBytes;
+
+private:
+	void addBlock(size_t minimumSize);
+
+public:
+	FrameArena();
+
+	FrameArena(const FrameArena&) = delete;
+	FrameArena& operator=(const FrameArena&) = delete;
+	FrameArena(FrameArena&&) = delete;
+	FrameArena& operator=(FrameArena&&) = delete;
+
+	static FrameArena& getThreadArena();
+
+	void* allocate(size_t bytes, size_t alignment);
+	// Frees everything at once, a frame that spilled into several blocks leaves one block big enough for all of it
+	void reset();
+
+	size_t getUsedBytes() const;
+	size_t getPeakBytes() const;
+};
+
+// Allocates from a FrameArena, deallocate is a no-op. Default-constructed allocators use the calling thread's arena.
+template <typename T>
+class FrameAllocator {
+public:
+	using value_type = T;
+
+	FrameArena* arena;
+
+	FrameAllocator() : arena(&FrameArena::getThreadArena()) {}
+	explicit FrameAllocator(FrameArena& arena) : arena(&arena) {}
+
+	template <typename U>
+	FrameAllocator(const FrameAllocator<U>& other) : arena(other.arena) {}
+
+	T* allocate(size_t count) {
+		return static_cast<T*>(arena->allocate(count * sizeof(T), alignof(T)));
+	}
+
+	void deallocate(T*, size_t) {}
+
+	template <typename U>
+	bool operator==(const FrameAllocator<U>& other) const {
+		return arena == other.arena;
+	}
+
+	template <typename U>
+	bool operator!=(const FrameAllocator<U>& other) const {
+		return arena != other.arena;
+	}
+};
+
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+using FrameString = std::basic_string<char, std::char_traits<char>, FrameAllocator<char>>;
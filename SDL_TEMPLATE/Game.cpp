@@ -16,22 +16,45 @@
 #include "WaveManager.h"
 #include "PlayerProfile.h"
 #include "Text.h"
-#include "FastEnemy.h"
+#include "EnemyArchetype.h"
 #include "Menu.h"
+#include "MenuState.h"
 #include "Selector.h"
 #include "GameProgressManager.h"
 #include "GameProgress.h"
 #include "GameSound.h"
-#include <cstring> 
-
-Game::Game() : gWindow(nullptr), gRenderer(nullptr), gameState(std::make_unique<GameMenu>()),
-				running(false) {}
+#include "RewindManager.h"
+#include "JobSystem.h"
+#include "RenderList.h"
+#include "SimulationThread.h"
+#include "DebugOverlay.h"
+#include "AllocationTracker.h"
+#include "GameClock.h"
+#include "Telemetry.h"
+#include "Logger.h"
+#include "FPSManager.h"
+
+Game::Game() : gameState(std::make_unique<GameMenu>()),
+				jobSystem(std::make_unique<JobSystem>(JobSystem::getDefaultWorkerCount())),
+				renderBuffers(std::make_unique<RenderBuffers>()),
+				simulationThread(std::make_unique<SimulationThread>()), headless(false),
+				lastUpdateNs(0), lastRenderNs(0), redrawPending(true),
+				mainThreadId(std::this_thread::get_id()), gWindow(nullptr), gRenderer(nullptr), running(false) {
+	deferredActions.reserve(DEFERRED_ACTION_CAPACITY);
+	runningActions.reserve(DEFERRED_ACTION_CAPACITY);
+}
 
 void Game::initSDLSubsystems() {
+	// Drivers picked through the environment still win over these
+	if (headless) {
+		SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+		SDL_setenv("SDL_AUDIODRIVER", "dummy", 0);
+	}
+
 	if (SDL_Init(SDL_INIT_EVERYTHING) < 0)
-		std::cout << "Failed to initialize SDL subsystems." << SDL_GetError() << '\n';
+		LOG_ERROR("Failed to initialize SDL subsystems: %s", SDL_GetError());
 	else
-		std::cout << "Initialized SDL subsystems." << '\n';
+		LOG_DEBUG("Initialized SDL subsystems.");
 }
 
 void Game::initWindowCreation() {
@@ -41,30 +64,32 @@ void Game::initWindowCreation() {
 		SDL_WINDOWPOS_CENTERED,
 		SCREEN_WIDTH,
 		SCREEN_HEIGHT,
-		SDL_WINDOW_SHOWN
+		headless ? SDL_WINDOW_HIDDEN : SDL_WINDOW_SHOWN
 	);
 
-	if (!gWindow) std::cout << "Failed to create window: " << SDL_GetError() << '\n';
-	else std::cout << "Window created." << '\n';
+	if (!gWindow) LOG_ERROR("Failed to create window: %s", SDL_GetError());
+	else LOG_DEBUG("Window created.");
 }
 
 void Game::initRendererCreation() {
-	gRenderer = SDL_CreateRenderer(gWindow, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+	const Uint32 vsyncFlag = FPSManager::getInstance()->isUncapped() ? 0 : SDL_RENDERER_PRESENTVSYNC;
+	const Uint32 rendererFlags = headless ? SDL_RENDERER_SOFTWARE : SDL_RENDERER_ACCELERATED | vsyncFlag;
+	gRenderer = SDL_CreateRenderer(gWindow, -1, rendererFlags);
 
-	if (!gRenderer) std::cout << "Failed to create renderer: " << SDL_GetError() << '\n';
-	else std::cout << "Renderer created." << '\n';
+	if (!gRenderer) LOG_ERROR("Failed to create renderer: %s", SDL_GetError());
+	else LOG_DEBUG("Renderer created.");
 }
 
 void Game::initSDL_image() {
 	int imgFlags = IMG_INIT_PNG;
 
-	if (!(IMG_Init(imgFlags) & imgFlags)) std::cout << "Warning: SDL_image could not initialize: " << IMG_GetError() << '\n';
-	else std::cout << "SDL_image initialized." << '\n';
+	if (!(IMG_Init(imgFlags) & imgFlags)) LOG_WARNING("SDL_image could not initialize: %s", IMG_GetError());
+	else LOG_DEBUG("SDL_image initialized.");
 }
 
 void Game::initSDL_ttf() {
-	if (TTF_Init() == -1) std::cout << "SDL_TTF could not initialize: " << TTF_GetError() << '\n';
-	else std::cout << "SDL_TTF initialized." << '\n';
+	if (TTF_Init() == -1) LOG_ERROR("SDL_TTF could not initialize: %s", TTF_GetError());
+	else LOG_DEBUG("SDL_TTF initialized.");
 }
 
 void Game::initFonts() {
@@ -114,6 +139,7 @@ void Game::initPlayer() {
 
 void Game::initBullet() {
 	std::shared_ptr<Bullet> bulletPrototype = std::make_shared<Bullet>();
+	Bullet::sharedTexture = std::make_shared<TextureType>(Prototype_Type::BULLET);
 
 	PrototypeRegistry::getInstance()->addPrototype(
 		Prototype_Type::BULLET, std::static_pointer_cast<Prototype>(bulletPrototype)
@@ -132,8 +158,8 @@ void Game::initEnemy() {
 		);
 
 		// Normal Enemy Fast
-		std::shared_ptr<Enemy> clonedNormalEnemy = std::static_pointer_cast<Enemy>(normalEnemyPrototype->clone());
-		std::shared_ptr<FastEnemy> fastNormalEnemyPrototype = std::make_shared<FastEnemy>(clonedNormalEnemy);
+		std::shared_ptr<EnemyType> fastNormalEnemyPrototype = EnemyType::createArchetype<FastArchetype>(
+			*normalEnemyPrototype, Prototype_Type::NORMAL_ENEMY_FAST);
 
 		PrototypeRegistry::getInstance()->addPrototype(
 			Prototype_Type::NORMAL_ENEMY_FAST, std::static_pointer_cast<Prototype>(fastNormalEnemyPrototype)
@@ -151,11 +177,11 @@ void Game::initEnemy() {
 		);
 
 		// Medium Enemy Fast
-		std::shared_ptr<Enemy> clonedMediumEnemy = std::static_pointer_cast<Enemy>(mediumEnemyPrototype->clone());
-		std::shared_ptr<FastEnemy> fastNormalEnemyPrototype = std::make_shared<FastEnemy>(clonedMediumEnemy);
+		std::shared_ptr<EnemyType> fastMediumEnemyPrototype = EnemyType::createArchetype<FastArchetype>(
+			*mediumEnemyPrototype, Prototype_Type::MEDIUM_ENEMY_FAST);
 
 		PrototypeRegistry::getInstance()->addPrototype(
-			Prototype_Type::MEDIUM_ENEMY_FAST, std::static_pointer_cast<Prototype>(fastNormalEnemyPrototype)
+			Prototype_Type::MEDIUM_ENEMY_FAST, std::static_pointer_cast<Prototype>(fastMediumEnemyPrototype)
 		);
 	}
 
@@ -170,8 +196,8 @@ void Game::initEnemy() {
 		);
 
 		// Large Enemy Fast
-		std::shared_ptr<Enemy> clonedLargeEnemy = std::static_pointer_cast<Enemy>(largeEnemyPrototype->clone());
-		std::shared_ptr<FastEnemy> fastLargeEnemyPrototype = std::make_shared<FastEnemy>(clonedLargeEnemy);
+		std::shared_ptr<EnemyType> fastLargeEnemyPrototype = EnemyType::createArchetype<FastArchetype>(
+			*largeEnemyPrototype, Prototype_Type::LARGE_ENEMY_FAST);
 
 		PrototypeRegistry::getInstance()->addPrototype(
 			Prototype_Type::LARGE_ENEMY_FAST, std::static_pointer_cast<Prototype>(fastLargeEnemyPrototype)
@@ -200,6 +226,7 @@ Game* Game::getInstance() {
 void Game::clearAllPlayers() {
 	Player::playerCounter = 1;
 	InvokerPlaying::getInstance()->players.clear();
+	playerProfiles.clear();
 }
 
 void Game::addPlayer() {
@@ -208,7 +235,11 @@ void Game::addPlayer() {
 		PrototypeRegistry::getInstance()->getPrototype(Prototype_Type::PLAYER)
 	);
 
-	player1->initProfile();
+	player1->init();
+
+	std::unique_ptr<PlayerProfile> profile1 = std::make_unique<PlayerProfile>();
+	profile1->init(player1->getID(), *player1->heartAmount, *player1->maxSprintAmount);
+	playerProfiles[player1->getID()] = std::move(profile1);
 
 	// Add player to invoker
 	InvokerPlaying::getInstance()->addPlayer(player1);
@@ -219,7 +250,7 @@ void Game::addPlayer() {
 	//		PrototypeRegistry::getInstance()->getPrototype(Prototype_Type::PLAYER)
 	//	);
 
-	//	player2->initProfile();
+	//	player2->init();
 
 	//	// Add player to invoker
 	//	InvokerPlaying::getInstance()->addPlayer(player2);
@@ -229,7 +260,7 @@ void Game::addPlayer() {
 	//		PrototypeRegistry::getInstance()->getPrototype(Prototype_Type::PLAYER)
 	//	);
 
-	//	player3->initProfile();
+	//	player3->init();
 
 	//	// Add player to invoker
 	//	InvokerPlaying::getInstance()->addPlayer(player3);
@@ -239,7 +270,7 @@ void Game::addPlayer() {
 	//		PrototypeRegistry::getInstance()->getPrototype(Prototype_Type::PLAYER)
 	//	);
 
-	//	player4->initProfile();
+	//	player4->init();
 
 	//	// Add player to invoker
 	//	InvokerPlaying::getInstance()->addPlayer(player4);
@@ -297,9 +328,62 @@ void Game::addPlayer() {
 	InvokerPlaying::getInstance()->assignKeyToCommand(Command_Actions::unfire, unfireCommand, player1);
 }
 
+// Deferred, so a state can be replaced from its own update
 void Game::setState(std::unique_ptr<GameState> state) {
+	pendingState = std::move(state);
+}
+
+void Game::runOnMainThread(std::function<void()> action) {
+	if (std::this_thread::get_id() == mainThreadId) {
+		action();
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(deferredMutex);
+	deferredActions.push_back(std::move(action));
+}
+
+void Game::showGameOver() {
+	setState(std::make_unique<GameOver>());
+	Menu::getInstance()->setState(std::make_unique<GameOverMenu>());
+}
+
+// Swapped out first, so an action may queue another one
+void Game::runDeferredActions() {
+	{
+		std::lock_guard<std::mutex> lock(deferredMutex);
+		if (deferredActions.empty()) return;
+		deferredActions.swap(runningActions);
+	}
+
+	for (auto& action : runningActions) {
+		action();
+	}
+	runningActions.clear();
+}
+
+void Game::applyPendingState() {
+	if (!pendingState) return;
+
 	Menu::getInstance()->resetFlags();
-	gameState = std::move(state);
+	gameState = std::move(pendingState);
+	GameClock::getInstance()->setPaused(gameState->pausesGameClock());
+	GameClock::getInstance()->setManualStepping(gameState->runsOnSimulationThread());
+	redrawPending = true;
+}
+
+// Each tick steps game time by one TICK_NS, so fast-forward runs more ticks rather than longer ones
+int Game::getTicksPerFrame() const {
+	const int ticks = static_cast<int>(GameClock::getInstance()->getTimeScale() + 0.5);
+	return ticks > 1 ? ticks : 1;
+}
+
+void Game::cycleTimeScale() {
+	GameClock* clock = GameClock::getInstance();
+	const double timeScale = clock->getTimeScale() * 2.0;
+
+	clock->setTimeScale(timeScale > MAX_TIME_SCALE ? 1.0 : timeScale);
+	LOG_INFO("Time scale: %gx", clock->getTimeScale());
 }
 
 void Game::startGame() {
@@ -308,12 +392,15 @@ void Game::startGame() {
 
 	WaveManager::getInstance()->resetGame();
 	Bullet::bullets.clear();
+	RewindManager::getInstance()->reset();
 
 	GameSound::getInstance()->stopMusic();
+
+	renderBuffers->captureFront();
 }
 
 void Game::resetProgress() {
-	strncpy_s(gameProgress->playerName, sizeof(gameProgress->playerName), Player::staticStringPlayerName.c_str(), _TRUNCATE);
+	SDL_strlcpy(gameProgress->playerName, Player::staticStringPlayerName.c_str(), sizeof(gameProgress->playerName));
 	gameProgress->waveCount = 0;
 	gameProgress->score = 0;
 
@@ -331,7 +418,7 @@ void Game::loadProgress() {
 
 
 void Game::saveProgress() {
-	strncpy_s(gameProgress->playerName, sizeof(gameProgress->playerName), Player::staticStringPlayerName.c_str(), _TRUNCATE);
+	SDL_strlcpy(gameProgress->playerName, Player::staticStringPlayerName.c_str(), sizeof(gameProgress->playerName));
 	gameProgress->playerName[sizeof(gameProgress->playerName) - 1] = '\0';
 	gameProgress->waveCount = WaveManager::getInstance()->getWaveCount();
 	gameProgress->score = Player::staticScore;
@@ -339,6 +426,10 @@ void Game::saveProgress() {
 	GameProgressManager::getInstance()->saveProgress(*gameProgress);
 }
 
+void Game::setHeadless(bool headless) {
+	this->headless = headless;
+}
+
 void Game::initAll() {
 	initSDLSubsystems();
 	initWindowCreation();
@@ -360,33 +451,137 @@ void Game::initAll() {
 	initGameProgress();
 }
 
+bool Game::isIdle() const {
+	return gameState->waitsForInput() && !pendingState && !redrawPending;
+}
+
+void Game::handleEvent() {
+	redrawPending = true;
+
+	if (gEvent.type == SDL_QUIT) {
+		setRunningToFalse();
+	}
+
+	if (gEvent.type == SDL_KEYDOWN && gEvent.key.keysym.sym == SDLK_F3 && !gEvent.key.repeat) {
+		DebugOverlay::getInstance()->toggle();
+		return;
+	}
+
+	if (gEvent.type == SDL_KEYDOWN && gEvent.key.keysym.sym == SDLK_F4 && !gEvent.key.repeat) {
+		cycleTimeScale();
+		return;
+	}
+
+	gameState->input();
+}
+
 void Game::input() {
-	while (SDL_PollEvent(&gEvent)) {
-		if (gEvent.type == SDL_QUIT) {
-			setRunningToFalse();
-		}
+	// Input mutates the world, so the tick started last frame has to finish first
+	if (simulationThread->waitForTick()) renderBuffers->swap();
+	runDeferredActions();
+
+	// Menus sleep in the event queue until something happens instead of redrawing an unchanged screen at 60 FPS
+	if (isIdle()) {
+		const Uint32 overlayWaitMs = DebugOverlay::getInstance()->getMsUntilRefresh();
+		const Uint32 waitMs = overlayWaitMs < IDLE_WAIT_MS ? overlayWaitMs : IDLE_WAIT_MS;
 
-		gameState->input();
+		if (SDL_WaitEventTimeout(&gEvent, static_cast<int>(waitMs))) handleEvent();
+		else if (overlayWaitMs <= IDLE_WAIT_MS) redrawPending = true;
+
+		FPSManager::getInstance()->restartPacing();
+	}
+
+	while (SDL_PollEvent(&gEvent)) {
+		handleEvent();
 	}
 }
 
 void Game::update() {
-	gameState->update();
+	applyPendingState();
+	GameSound::getInstance()->beginFrame();
+
+	if (isIdle()) {
+		lastUpdateNs = 0;
+		return;
+	}
+
+	if (gameState->runsOnSimulationThread()) {
+		// Overlaps with render, which only reads the front render list
+		const int ticks = getTicksPerFrame();
+		simulationThread->startTick([this, ticks] {
+			const Uint64 tickStart = GameClock::getRealTimeNs();
+
+			for (int tick = 0; tick < ticks; tick++) {
+				GameClock::getInstance()->step(GameClock::TICK_NS);
+				gameState->update();
+			}
+			renderBuffers->getBack().capture();
+
+			lastUpdateNs = GameClock::getRealTimeNs() - tickStart;
+		});
+	} else {
+		const Uint64 updateStart = GameClock::getRealTimeNs();
+		gameState->update();
+		lastUpdateNs = GameClock::getRealTimeNs() - updateStart;
+	}
 }
 
 void Game::render() {
+	// The last presented frame stays on screen, the window system asks for a repaint with an expose event
+	if (isIdle()) {
+		lastRenderNs = 0;
+		return;
+	}
+	redrawPending = false;
+
+	const Uint64 renderStart = GameClock::getRealTimeNs();
+
 	SDL_SetRenderDrawColor(gRenderer, 255, 255, 255, 255);
 	SDL_RenderClear(gRenderer);
 
 	gameState->render();
+	DebugOverlay::getInstance()->render();
 
 	SDL_RenderPresent(gRenderer);
+
+	lastRenderNs = GameClock::getRealTimeNs() - renderStart;
+}
+
+// Profiles only draw what the render list captured, like the players themselves
+void Game::renderPlayerProfiles(const std::vector<PlayerRenderState>& playerStates) {
+	for (const auto& playerState : playerStates) {
+		auto it = playerProfiles.find(playerState.ID);
+		if (it != playerProfiles.end()) it->second->render(playerState);
+	}
 }
 
 SDL_Renderer* Game::getRenderer() {
 	return gRenderer;
 }
 
+JobSystem* Game::getJobSystem() {
+	return jobSystem.get();
+}
+
+RenderBuffers* Game::getRenderBuffers() {
+	return renderBuffers.get();
+}
+
+Uint64 Game::getLastUpdateNs() const {
+	return lastUpdateNs;
+}
+
+Uint64 Game::getLastRenderNs() const {
+	return lastRenderNs;
+}
+
+void Game::close() {
+	simulationThread->waitForTick();
+
+	Telemetry::getInstance()->stop();
+	AllocationTracker::dump(std::cout);
+}
+
 const SDL_Event& Game::getEvent() const {
 	return gEvent;
 }
@@ -1,16 +1,36 @@
 #pragma once
 #include <SDL.h>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 #include <SDL_ttf.h>
+#include "GameHost.h"
 
 class GameState;
+class JobSystem;
+class SimulationThread;
+class RenderBuffers;
+class PlayerProfile;
 struct GameProgress;
+struct PlayerRenderState;
 
-class Game {
+class Game : public GameHost {
+private:
+	constexpr static double MAX_TIME_SCALE = 8.0; // Fast-forward steps 1x, 2x, 4x, 8x
+	constexpr static size_t DEFERRED_ACTION_CAPACITY = 64; // Reserved up front, so a busy tick queues without allocating
+	constexpr static Uint32 IDLE_WAIT_MS = 250; // Longest idle sleep, sound streaming still needs a beginFrame now and then
 
 private:
 	std::unique_ptr<GameState> gameState;
+	std::unique_ptr<GameState> pendingState; // Applied at the start of the next update
 	std::unique_ptr<GameProgress> gameProgress;
+	std::unique_ptr<JobSystem> jobSystem;
+	std::unique_ptr<RenderBuffers> renderBuffers;
+	std::unordered_map<int, std::unique_ptr<PlayerProfile>> playerProfiles; // HUD panel per player ID
+	std::unique_ptr<SimulationThread> simulationThread; // Last so it is joined before the rest is destroyed
 
 protected:
 	Game();
@@ -23,6 +43,14 @@ public:
 
 private:
 	SDL_Event gEvent;
+	bool headless; // Dummy video and audio drivers with a software renderer, for benchmarks and CI
+	Uint64 lastUpdateNs; // Written by whichever thread ran the tick, read after it is joined
+	Uint64 lastRenderNs;
+	bool redrawPending; // Set by events and state changes, states that wait for input only update and render then
+	std::thread::id mainThreadId;
+	std::mutex deferredMutex;
+	std::vector<std::function<void()>> deferredActions; // Queued by the simulation thread, run after the tick is joined
+	std::vector<std::function<void()>> runningActions;
 
 public:
 	SDL_Window* gWindow;
@@ -50,12 +78,21 @@ private:
 	void initGameProgress();
 	void clearAllPlayers();
 	void addPlayer();
+	void applyPendingState();
+	void runDeferredActions();
+	void handleEvent();
+	void cycleTimeScale();
+	int getTicksPerFrame() const;
 
 public:
 	static Game* getInstance();
 
 public:
-	void setState(std::unique_ptr<GameState> state);
+	void setState(std::unique_ptr<GameState> state); // Main thread only
+	bool isIdle() const; // Waiting for input, update and render skip the frame
+
+	void runOnMainThread(std::function<void()> action) override;
+	void showGameOver() override;
 
 	void startGame();
 
@@ -63,12 +100,20 @@ public:
 	void loadProgress();
 	void saveProgress();
 
+	void setHeadless(bool headless); // Must be called before initAll
 	void initAll();
 	void input();
 	void update();
 	void render();
+	void close();
+
+	void renderPlayerProfiles(const std::vector<PlayerRenderState>& playerStates);
 
-	SDL_Renderer* getRenderer();
+	SDL_Renderer* getRenderer() override;
+	JobSystem* getJobSystem() override;
+	RenderBuffers* getRenderBuffers();
+	Uint64 getLastUpdateNs() const;
+	Uint64 getLastRenderNs() const;
 	const SDL_Event& getEvent() const;
 	const bool& isRunning() const;
 	void setRunningToFalse();
@@ -0,0 +1,70 @@
+#include "GameClock.h"
+
+GameClock::GameClock() : baseRealNs(getRealTimeNs()), baseGameNs(0), timeScale(1.0), paused(false), manualStepping(false) {}
+
+GameClock* GameClock::getInstance() {
+	static GameClock instance;
+	return &instance;
+}
+
+// Split into whole seconds first, counter * 1e9 overflows after a few hours on fast counters
+Uint64 GameClock::getRealTimeNs() {
+	static const Uint64 frequency = SDL_GetPerformanceFrequency();
+	static const Uint64 origin = SDL_GetPerformanceCounter();
+
+	const Uint64 counter = SDL_GetPerformanceCounter() - origin;
+	return (counter / frequency) * NANOSECONDS_PER_SECOND + (counter % frequency) * NANOSECONDS_PER_SECOND / frequency;
+}
+
+void GameClock::rebase() {
+	baseGameNs = getTimeNs();
+	baseRealNs = getRealTimeNs();
+}
+
+Uint64 GameClock::getTimeNs() const {
+	if (paused || manualStepping) return baseGameNs;
+
+	return baseGameNs + static_cast<Uint64>((getRealTimeNs() - baseRealNs) * timeScale);
+}
+
+Uint32 GameClock::getTimeMs() const {
+	return static_cast<Uint32>(getTimeNs() / NANOSECONDS_PER_MILLISECOND);
+}
+
+void GameClock::setPaused(bool paused) {
+	if (this->paused == paused) return;
+
+	rebase();
+	this->paused = paused;
+}
+
+bool GameClock::isPaused() const {
+	return paused;
+}
+
+void GameClock::setTimeScale(double timeScale) {
+	rebase();
+	this->timeScale = timeScale > 0.0 ? timeScale : 0.0;
+}
+
+double GameClock::getTimeScale() const {
+	return timeScale;
+}
+
+void GameClock::setManualStepping(bool manualStepping) {
+	if (this->manualStepping == manualStepping) return;
+
+	rebase();
+	this->manualStepping = manualStepping;
+}
+
+bool GameClock::isManualStepping() const {
+	return manualStepping;
+}
+
+// Not scaled, a faster clock runs more steps instead so every tick still sees its own time
+void GameClock::step(Uint64 nanoseconds) {
+	if (!manualStepping || paused) return;
+
+	baseGameNs += nanoseconds;
+}
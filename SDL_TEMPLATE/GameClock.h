@@ -0,0 +1,52 @@
+#pragma once
+#include <SDL.h>
+#include <atomic>
+
+// Nanosecond monotonic time for the whole game. Real time comes straight from the performance counter,
+// game time follows it scaled, stands still while paused and can be stepped by hand instead, one TICK_NS per
+// simulation tick. Changed from the main thread between simulation ticks, stepped by whichever thread runs them,
+// read from anywhere.
+class GameClock {
+private:
+	GameClock();
+
+public:
+	GameClock(const GameClock&) = delete;
+	GameClock& operator=(const GameClock&) = delete;
+	GameClock(GameClock&&) = delete;
+	GameClock& operator=(GameClock&&) = delete;
+
+	static GameClock* getInstance();
+
+public:
+	constexpr static Uint64 NANOSECONDS_PER_MILLISECOND = 1000000;
+	constexpr static Uint64 NANOSECONDS_PER_SECOND = 1000000000;
+	constexpr static Uint64 TICK_NS = NANOSECONDS_PER_SECOND / 60; // Game time one simulation tick covers
+
+private:
+	Uint64 baseRealNs; // Game time is real time since this point, scaled, plus baseGameNs
+	std::atomic<Uint64> baseGameNs;
+	double timeScale;
+	bool paused;
+	bool manualStepping;
+
+private:
+	void rebase();
+
+public:
+	static Uint64 getRealTimeNs(); // Since the first call, never scaled or paused
+
+	Uint64 getTimeNs() const;
+	Uint32 getTimeMs() const;
+
+	void setPaused(bool paused);
+	bool isPaused() const;
+
+	void setTimeScale(double timeScale);
+	double getTimeScale() const;
+
+	// While on, game time only moves through step, and the time scale only sets how many ticks a frame runs
+	void setManualStepping(bool manualStepping);
+	bool isManualStepping() const;
+	void step(Uint64 nanoseconds);
+};
@@ -0,0 +1,15 @@
+#include "GameHost.h"
+
+GameHost* GameHost::instance = nullptr;
+
+GameHost::GameHost() {
+	instance = this;
+}
+
+GameHost::~GameHost() {
+	if (instance == this) instance = nullptr;
+}
+
+GameHost* GameHost::getInstance() {
+	return instance;
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include <SDL.h>
+#include <functional>
+
+class JobSystem;
+
+// What the simulation needs from the application running it. Game registers itself as the host, so the
+// simulation core reaches the renderer, the workers and the main thread without including the front end.
+class GameHost {
+private:
+	static GameHost* instance;
+
+protected:
+	GameHost();
+	virtual ~GameHost();
+
+public:
+	GameHost(const GameHost&) = delete;
+	GameHost& operator=(const GameHost&) = delete;
+	GameHost(GameHost&&) = delete;
+	GameHost& operator=(GameHost&&) = delete;
+
+	static GameHost* getInstance();
+
+public:
+	virtual SDL_Renderer* getRenderer() = 0;
+	virtual JobSystem* getJobSystem() = 0;
+
+	// Runs right away on the main thread. From the simulation thread it runs once the tick is joined, for side
+	// effects on menus, sound and game states that the main thread reads while the tick runs.
+	virtual void runOnMainThread(std::function<void()> action) = 0;
+
+	// Every player is dead and the dead timer ran out. Main thread only
+	virtual void showGameOver() = 0;
+};
@@ -1,6 +1,6 @@
 #include "GameProgressManager.h"
-#include <iostream>
 #include "GameProgress.h"
+#include "Logger.h"
 
 GameProgressManager::GameProgressManager() : file(nullptr) {}
 
@@ -10,43 +10,45 @@ GameProgressManager* GameProgressManager::getInstance() {
 }
 
 void GameProgressManager::loadProgress(GameProgress& progress) {
-    fopen_s(&file, FILE_PATH, "rb");
+    file = SDL_RWFromFile(FILE_PATH, "rb");
 
     if (!file) {
-        std::cout << "Failed to open progress path." << '\n';
+        LOG_ERROR("Failed to open progress path %s: %s", FILE_PATH, SDL_GetError());
         return;
     } else {
-        std::cout << "Progress path opened." << '\n';
+        LOG_DEBUG("Progress path opened.");
     }
 
-    size_t elements_read = fread_s(&progress, sizeof(GameProgress), sizeof(GameProgress), 1, file);
+    size_t elements_read = SDL_RWread(file, &progress, sizeof(GameProgress), 1);
 
-    fclose(file);
+    SDL_RWclose(file);
+    file = nullptr;
 
     if (elements_read == 0) {
-        std::cout << "Failed to read data." << '\n';
+        LOG_ERROR("Failed to read data.");
     } else {
-        std::cout << "Successfully read data." << '\n';
+        LOG_DEBUG("Successfully read data.");
     }
 }
 
 void GameProgressManager::saveProgress(const GameProgress& progress) {
-    fopen_s(&file, FILE_PATH, "wb");
+    file = SDL_RWFromFile(FILE_PATH, "wb");
 
     if (!file) {
-        std::cout << "Failed to open progress path." << '\n';
+        LOG_ERROR("Failed to open progress path %s: %s", FILE_PATH, SDL_GetError());
         return;
     } else {
-        std::cout << "Progress path opened." << '\n';
+        LOG_DEBUG("Progress path opened.");
     }
 
-    size_t elements_written = fwrite(&progress, sizeof(GameProgress), 1, file);
+    size_t elements_written = SDL_RWwrite(file, &progress, sizeof(GameProgress), 1);
 
-    fclose(file);
+    SDL_RWclose(file);
+    file = nullptr;
 
     if (elements_written == 0) {
-        std::cout << "Failed to write data." << '\n';
+        LOG_ERROR("Failed to write data.");
     } else {
-        std::cout << "Successfully write data." << '\n';
+        LOG_DEBUG("Successfully write data.");
     }
 }
@@ -1,6 +1,5 @@
 #pragma once
 #include <SDL.h>
-#include <functional>
 
 struct GameProgress;
 
@@ -16,7 +15,7 @@ public:
 
 private:
 	static constexpr const  char* FILE_PATH = "progress.bin";
-	FILE* file;
+	SDL_RWops* file; // SDL file I/O, portable where fopen_s and fread_s are MSVC-only
 
 public:
 	static GameProgressManager* getInstance();
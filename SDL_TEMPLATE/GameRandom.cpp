@@ -0,0 +1,10 @@
+#include "GameRandom.h"
+
+std::mt19937& GameRandom::getEngine() {
+	static std::mt19937 engine(std::random_device{}());
+	return engine;
+}
+
+void GameRandom::seed(Uint32 seed) {
+	getEngine().seed(seed);
+}
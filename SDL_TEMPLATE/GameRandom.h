@@ -0,0 +1,11 @@
+#pragma once
+#include <SDL.h>
+#include <random>
+
+// Shared engine for spawn rolls. Seeded from the OS by default, benchmarks and soak runs reseed it
+// so the same scenario spawns the same waves. Only used from the thread running the simulation.
+class GameRandom {
+public:
+	static std::mt19937& getEngine();
+	static void seed(Uint32 seed);
+};
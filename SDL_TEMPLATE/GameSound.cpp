@@ -1,20 +1,27 @@
 #include "GameSound.h"
-#include <iostream>
+#include "AllocationTracker.h"
+#include "Logger.h"
+#include <fstream>
+#include <sstream>
 
 GameSound::GameSound()
-    : music(nullptr),
-    click(nullptr),
-    minorClick(nullptr),
-    damage(nullptr),
-    fire(nullptr),
-    largeEnemySpawned(nullptr),
-    largeEnemyDead(nullptr),
-    mediumEnemyDead(nullptr),
-    normalEnemyDead(nullptr),
-    select(nullptr),
-    gameOver(nullptr),
-    ticking(nullptr),
-    tickingChannel(-1) {
+    : tickingChannel(-1),
+    music(nullptr),
+    loadedBytes(0),
+    channelSound(VOICE_CHANNELS, -1),
+    channelStartTicks(VOICE_CHANNELS, 0),
+    frameCounter(1),
+    voiceStats{},
+    loaderRunning(false) {
+}
+
+GameSound::~GameSound() {
+    stopLoader();
+
+    for (auto& entry : sounds) {
+        if (entry.chunk) Mix_FreeChunk(entry.chunk);
+        entry.chunk = nullptr;
+    }
 }
 
 GameSound* GameSound::getInstance() {
@@ -22,90 +29,293 @@ GameSound* GameSound::getInstance() {
     return &instance;
 }
 
+// Used when the manifest is missing, mirrors assets/audio/sfx.manifest
+std::vector<SoundEntry> GameSound::getDefaultSounds() {
+    constexpr SoundResidency RESIDENT = SoundResidency::RESIDENT;
+    constexpr SoundResidency STREAMED = SoundResidency::STREAMED;
+
+    std::vector<SoundEntry> defaults = {
+        { "click", "assets/audio/click.wav", 54, { 1, 60, true }, RESIDENT },
+        { "minorClick", "assets/audio/minorClick.wav", 65, { 1, 60, true }, RESIDENT },
+        { "damage", "assets/audio/damage.wav", 54, { 2, 70, true }, RESIDENT },
+        { "fire", "assets/audio/fire.wav", 25, { 4, 20, true }, RESIDENT },
+        { "largeEnemySpawned", "assets/audio/largeEnemySpawned.wav", 60, { 1, 80, false }, STREAMED },
+        { "largeEnemyDead", "assets/audio/largeEnemy.wav", 40, { 2, 50, true }, RESIDENT },
+        { "mediumEnemyDead", "assets/audio/mediumEnemy.wav", 40, { 2, 40, true }, RESIDENT },
+        { "normalEnemyDead", "assets/audio/normalEnemy.wav", 40, { 3, 30, true }, RESIDENT },
+        { "select", "assets/audio/select.wav", 14, { 1, 60, true }, RESIDENT },
+        { "gameOver", "assets/audio/gameOver.wav", 7, { 1, 90, false }, STREAMED },
+        { "ticking", "assets/audio/ticking.wav", 70, { 1, 100, false }, RESIDENT }
+    };
+
+    return defaults;
+}
+
 void GameSound::initMixer() {
+    AllocationTagScope allocationTag(Allocation_Tag::AUDIO);
+
 	if (Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 2048) < 0) {
-		std::cout << "Warning: Failed to setup music controller: " << Mix_GetError() << '\n';
+		LOG_WARNING("Failed to setup music controller: %s", Mix_GetError());
     } else {
-        std::cout << "SDL mixer loaded." << '\n';
+        LOG_DEBUG("SDL mixer loaded.");
     }
 
+    Mix_AllocateChannels(VOICE_CHANNELS);
+
     loadMusic();
     loadSoundFX();
     setAudiosVolume();
+    startLoader();
+
+    for (int soundIndex = 0; soundIndex < static_cast<int>(sounds.size()); soundIndex++) {
+        if (sounds[soundIndex].residency == SoundResidency::RESIDENT) queueLoad(soundIndex);
+    }
 }
 
 void GameSound::loadMusic() {
 	music = Mix_LoadMUS("assets/audio/Hear What They Say.mp3");
 
 	if (music) {
-		std::cout << "Loaded music." << '\n';
+		LOG_DEBUG("Loaded music.");
 	} else {
-		std::cout << "Failed to load music: " << Mix_GetError();
+		LOG_ERROR("Failed to load music: %s", Mix_GetError());
 	}
 }
 
-void GameSound::loadSoundFX() {
-    click = Mix_LoadWAV("assets/audio/click.wav");
-    if (click) std::cout << "SFX click loaded." << '\n';
-    else std::cout << "Failed to load SFX click: " << Mix_GetError() << '\n';
+void GameSound::registerSound(const SoundEntry& entry) {
+    auto it = soundIndices.find(entry.name);
+
+    if (it != soundIndices.end()) {
+        SoundEntry& existing = sounds[it->second];
+        existing.path = entry.path;
+        existing.volume = entry.volume;
+        existing.policy = entry.policy;
+        existing.residency = entry.residency;
+    } else {
+        soundIndices[entry.name] = static_cast<int>(sounds.size());
+        sounds.push_back(entry);
+    }
+}
+
+// Manifest lines: <name> <path> <volume> <maxVoices> <priority> <stealOldest 0|1> [resident|streamed]
+bool GameSound::loadManifest() {
+    std::ifstream manifest(MANIFEST_PATH);
 
-    minorClick = Mix_LoadWAV("assets/audio/minorClick.wav");
-    if (click) std::cout << "SFX minorClick loaded." << '\n';
-    else std::cout << "Failed to load SFX minorClick: " << Mix_GetError() << '\n';
+    if (!manifest) {
+        LOG_INFO("SFX manifest %s not found, using built-in sound bank.", MANIFEST_PATH);
+        return false;
+    }
 
-    damage = Mix_LoadWAV("assets/audio/damage.wav");
-    if (damage) std::cout << "SFX damage loaded." << '\n';
-    else std::cout << "Failed to load SFX damage: " << Mix_GetError() << '\n';
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(manifest, line)) {
+        ++lineNumber;
+        if (line.empty() || line[0] == '#') continue;
 
-    fire = Mix_LoadWAV("assets/audio/fire.wav");
-    if (fire) std::cout << "SFX fire loaded." << '\n';
-    else std::cout << "Failed to load SFX fire: " << Mix_GetError() << '\n';
+        std::istringstream fields(line);
+        SoundEntry entry = {};
+        int steal = 0;
 
-    largeEnemySpawned = Mix_LoadWAV("assets/audiolargeEnemySpawned.wav");
-    if (largeEnemySpawned) std::cout << "SFX largeEnemySpawned loaded." << '\n';
-    else std::cout << "Failed to load SFX largeEnemySpawned: " << Mix_GetError() << '\n';
+        if (!(fields >> entry.name >> entry.path >> entry.volume
+            >> entry.policy.maxVoices >> entry.policy.priority >> steal)) {
+            LOG_WARNING("Skipping malformed SFX manifest line %d", lineNumber);
+            continue;
+        }
 
-    largeEnemyDead = Mix_LoadWAV("assets/audio/largeEnemy.wav");
-    if (largeEnemyDead) std::cout << "SFX largeEnemyDead loaded." << '\n';
-    else std::cout << "Failed to load SFX largeEnemyDead: " << Mix_GetError() << '\n';
+        entry.policy.stealOldest = steal != 0;
 
-    mediumEnemyDead = Mix_LoadWAV("assets/audio/mediumEnemy.wav");
-    if (mediumEnemyDead) std::cout << "SFX mediumEnemyDead loaded." << '\n';
-    else std::cout << "Failed to load SFX mediumEnemyDead: " << Mix_GetError() << '\n';
+        std::string residency;
+        fields >> residency;
+        entry.residency = residency == "streamed" ? SoundResidency::STREAMED : SoundResidency::RESIDENT;
 
-    normalEnemyDead = Mix_LoadWAV("assets/audio/normalEnemy.wav");
-    if (normalEnemyDead) std::cout << "SFX normalEnemyDead loaded." << '\n';
-    else std::cout << "Failed to load SFX normalEnemyDead: " << Mix_GetError() << '\n';
+        registerSound(entry);
+    }
 
-    select = Mix_LoadWAV("assets/audio/select.wav");
-    if (select) std::cout << "SFX select loaded." << '\n';
-    else std::cout << "Failed to load SFX select: " << Mix_GetError() << '\n';
+    return true;
+}
 
-    gameOver = Mix_LoadWAV("assets/audio/gameOver.wav");
-    if (gameOver) std::cout << "SFX gameOver loaded." << '\n';
-    else std::cout << "Failed to load SFX gameOver: " << Mix_GetError() << '\n';
+// Only registers the sound bank, resident sounds are decoded by the loader thread once the mixer is up
+void GameSound::loadSoundFX() {
+    sounds.clear();
+    soundIndices.clear();
 
-    ticking = Mix_LoadWAV("assets/audio/ticking.wav");
-    if (ticking) std::cout << "SFX ticking loaded." << '\n';
-    else std::cout << "Failed to load SFX ticking: " << Mix_GetError() << '\n';
+    for (const auto& entry : getDefaultSounds()) {
+        registerSound(entry);
+    }
+
+    loadManifest();
+
+    LOG_DEBUG("SFX bank registered %u sounds.", static_cast<unsigned>(sounds.size()));
 }
 
 void GameSound::setAudiosVolume() {
     Mix_VolumeMusic(60);
 
-    Mix_VolumeChunk(click, 54);
-    Mix_VolumeChunk(minorClick, 65);
-    Mix_VolumeChunk(damage, 54);
-    Mix_VolumeChunk(fire, 25);
-    Mix_VolumeChunk(largeEnemySpawned, 60);
-    Mix_VolumeChunk(largeEnemyDead, 40);
-    Mix_VolumeChunk(mediumEnemyDead, 40);
-    Mix_VolumeChunk(normalEnemyDead, 40);
-    Mix_VolumeChunk(select, 14);
-    Mix_VolumeChunk(gameOver, 7);
-    Mix_VolumeChunk(ticking, 70);
+    for (const auto& entry : sounds) {
+        if (entry.chunk) Mix_VolumeChunk(entry.chunk, entry.volume);
+    }
+}
+
+void GameSound::startLoader() {
+    if (loaderRunning) return;
+
+    finishedLoads.reserve(sounds.size());
+    installingLoads.reserve(sounds.size());
+
+    loaderRunning = true;
+    loaderThread = std::thread(&GameSound::loaderLoop, this);
+}
+
+void GameSound::stopLoader() {
+    {
+        std::lock_guard<std::mutex> lock(loaderMutex);
+        loaderRunning = false;
+    }
+    loaderCondition.notify_all();
+
+    if (loaderThread.joinable()) loaderThread.join();
+}
+
+void GameSound::loaderLoop() {
+    AllocationTagScope allocationTag(Allocation_Tag::AUDIO);
+
+    while (true) {
+        std::pair<int, std::string> request;
+
+        {
+            std::unique_lock<std::mutex> lock(loaderMutex);
+            loaderCondition.wait(lock, [this] { return !loaderRunning || !pendingLoads.empty(); });
+
+            if (!loaderRunning) return;
+
+            request = std::move(pendingLoads.front());
+            pendingLoads.pop_front();
+        }
+
+        FinishedLoad load = { request.first, Mix_LoadWAV(request.second.c_str()), "" };
+        if (!load.chunk) SDL_strlcpy(load.error, Mix_GetError(), sizeof(load.error));
+
+        std::lock_guard<std::mutex> lock(loaderMutex);
+        finishedLoads.push_back(load);
+    }
+}
+
+void GameSound::installChunk(int soundIndex, Mix_Chunk* chunk, const char* error) {
+    SoundEntry& entry = sounds[soundIndex];
+    entry.loading = false;
+
+    if (!chunk) {
+        entry.failed = true;
+        LOG_ERROR("Failed to load SFX %s: %s", entry.name.c_str(), error);
+        return;
+    }
+
+    entry.chunk = chunk;
+    entry.lastUsedTicks = SDL_GetTicks();
+    Mix_VolumeChunk(chunk, entry.volume);
+    loadedBytes += chunk->alen;
+    AllocationTracker::addExternal(Allocation_Tag::AUDIO, chunk->alen);
+
+    LOG_DEBUG("SFX %s loaded.", entry.name.c_str());
+
+    enforceMemoryBudget(soundIndex);
+}
+
+void GameSound::collectFinishedLoads() {
+    {
+        std::lock_guard<std::mutex> lock(loaderMutex);
+        installingLoads.swap(finishedLoads);
+    }
+
+    for (const auto& load : installingLoads) {
+        installChunk(load.soundIndex, load.chunk, load.error);
+    }
+    installingLoads.clear();
+}
+
+void GameSound::enforceMemoryBudget(int keepIndex) {
+    while (loadedBytes > MEMORY_BUDGET_BYTES) {
+        int victim = -1;
+
+        for (int soundIndex = 0; soundIndex < static_cast<int>(sounds.size()); soundIndex++) {
+            const SoundEntry& entry = sounds[soundIndex];
+            if (!entry.chunk || entry.residency == SoundResidency::RESIDENT ||
+                soundIndex == keepIndex || isSoundPlaying(soundIndex)) continue;
+
+            if (victim == -1 || entry.lastUsedTicks < sounds[victim].lastUsedTicks) victim = soundIndex;
+        }
+
+        if (victim == -1) break;
+
+        releaseChunk(victim);
+    }
 }
 
+void GameSound::releaseChunk(int soundIndex) {
+    SoundEntry& entry = sounds[soundIndex];
+
+    loadedBytes -= entry.chunk->alen;
+    AllocationTracker::addExternal(Allocation_Tag::AUDIO, -static_cast<long long>(entry.chunk->alen));
+    Mix_FreeChunk(entry.chunk);
+    entry.chunk = nullptr;
+
+    LOG_DEBUG("SFX %s released.", entry.name.c_str());
+}
+
+void GameSound::releaseIdleStreamedSounds() {
+    const Uint32 now = SDL_GetTicks();
+
+    for (int soundIndex = 0; soundIndex < static_cast<int>(sounds.size()); soundIndex++) {
+        const SoundEntry& entry = sounds[soundIndex];
+        if (!entry.chunk || entry.residency != SoundResidency::STREAMED) continue;
+        if (!SDL_TICKS_PASSED(now, entry.holdUntilTicks) || now - entry.lastUsedTicks < STREAMED_LINGER_MS) continue;
+        if (isSoundPlaying(soundIndex)) continue;
+
+        releaseChunk(soundIndex);
+    }
+}
+
+void GameSound::queueLoad(int soundIndex) {
+    SoundEntry& entry = sounds[soundIndex];
+    if (entry.chunk || entry.loading || entry.failed) return;
+
+    entry.loading = true;
+
+    {
+        std::lock_guard<std::mutex> lock(loaderMutex);
+        pendingLoads.push_back({ soundIndex, entry.path });
+    }
+    loaderCondition.notify_one();
+}
+
+bool GameSound::isSoundPlaying(int soundIndex) {
+    refreshChannels();
+
+    for (const auto& playing : channelSound) {
+        if (playing == soundIndex) return true;
+    }
+
+    return false;
+}
+
+Mix_Chunk* GameSound::getChunk(int soundIndex) {
+    SoundEntry& entry = sounds[soundIndex];
+
+    if (!entry.chunk && entry.loading) collectFinishedLoads();
+
+    if (entry.chunk) {
+        entry.lastUsedTicks = SDL_GetTicks();
+        return entry.chunk;
+    }
+
+    // Still decoding on the loader thread, or known to be missing
+    if (entry.loading || entry.failed) return nullptr;
+
+    Mix_Chunk* chunk = Mix_LoadWAV(entry.path.c_str());
+    installChunk(soundIndex, chunk, chunk ? "" : Mix_GetError());
+
+    return entry.chunk;
+}
 
 void GameSound::playMusic() {
     Mix_FadeInMusic(music, -1, 750);
@@ -115,45 +325,126 @@ void GameSound::stopMusic() {
     Mix_FadeOutMusic(500);
 }
 
+void GameSound::refreshChannels() {
+    for (int channel = 0; channel < VOICE_CHANNELS; channel++) {
+        if (channelSound[channel] != -1 && !Mix_Playing(channel)) {
+            channelSound[channel] = -1;
+        }
+    }
+}
+
+int GameSound::acquireChannel(int soundIndex) {
+    refreshChannels();
+
+    const VoicePolicy& policy = sounds[soundIndex].policy;
+
+    int activeInstances = 0;
+    int oldestInstance = -1;
+    int freeChannel = -1;
+    int victim = -1;
+    int victimPriority = policy.priority;
+
+    for (int channel = 0; channel < VOICE_CHANNELS; channel++) {
+        const int playing = channelSound[channel];
+
+        if (playing == -1) {
+            if (freeChannel == -1) freeChannel = channel;
+        } else if (playing == soundIndex) {
+            ++activeInstances;
+            if (oldestInstance == -1 || channelStartTicks[channel] < channelStartTicks[oldestInstance]) {
+                oldestInstance = channel;
+            }
+        } else {
+            // Steal from the lowest priority voice, the oldest one among equals
+            const int priority = sounds[playing].policy.priority;
+            if (priority < victimPriority ||
+                (victim != -1 && priority == victimPriority && channelStartTicks[channel] < channelStartTicks[victim])) {
+                victim = channel;
+                victimPriority = priority;
+            }
+        }
+    }
+
+    if (activeInstances >= policy.maxVoices) {
+        return policy.stealOldest ? oldestInstance : -1;
+    }
+
+    if (freeChannel != -1) return freeChannel;
+
+    return victim;
+}
+
+void GameSound::playSound(int soundIndex, int loops) {
+    AllocationTagScope allocationTag(Allocation_Tag::AUDIO);
+
+    ++voiceStats.requested;
+
+    // Identical effects triggered in the same frame would only stack into clipping
+    SoundEntry& entry = sounds[soundIndex];
+    if (entry.lastPlayedFrame == frameCounter) {
+        ++voiceStats.deduplicated;
+        ++voiceStats.dropped;
+        return;
+    }
+
+    Mix_Chunk* chunk = getChunk(soundIndex);
+    if (!chunk) {
+        ++voiceStats.dropped;
+        return;
+    }
+
+    int channel = acquireChannel(soundIndex);
+    if (channel == -1) {
+        ++voiceStats.dropped;
+        return;
+    }
+
+    if (channelSound[channel] != -1) {
+        Mix_HaltChannel(channel);
+        ++voiceStats.stolen;
+    }
+
+    if (Mix_PlayChannel(channel, chunk, loops) == -1) {
+        channelSound[channel] = -1;
+        ++voiceStats.dropped;
+        return;
+    }
+
+    channelSound[channel] = soundIndex;
+    channelStartTicks[channel] = SDL_GetTicks();
+    entry.lastPlayedFrame = frameCounter;
+    ++voiceStats.played;
+
+    if (soundIndex == static_cast<int>(SFX::ticking)) tickingChannel = channel;
+}
+
 void GameSound::playSoundFX(const SFX& sfx) {
-    switch (sfx) {
-    case SFX::click:
-        Mix_PlayChannel(-1, click, 0);
-        break;
-    case SFX::minorClick:
-        Mix_PlayChannel(-1, minorClick, 0);
-        break;
-    case SFX::damage:
-        Mix_PlayChannel(-1, damage, 0);
-        break;
-    case SFX::fire:
-        Mix_PlayChannel(-1, fire, 0);
-        break;
-    case SFX::largeEnemySpawned:
-        Mix_PlayChannel(-1, largeEnemySpawned, 0);
-        break;
-    case SFX::largeEnemyDead:
-        Mix_PlayChannel(-1, largeEnemyDead, 0);
-        break;
-    case SFX::mediumEnemyDead:
-        Mix_PlayChannel(-1, mediumEnemyDead, 0);
-        break;
-    case SFX::normalEnemyDead:
-        Mix_PlayChannel(-1, normalEnemyDead, 0);
-        break;
-    case SFX::select:
-        Mix_PlayChannel(-1, select, 0);
-        break;
-    case SFX::gameOver:
-        Mix_PlayChannel(-1, gameOver, 0);
-        break;
-    case SFX::ticking:
-        tickingChannel = Mix_PlayChannel(-1, ticking, -1);
-        break;
-    default:
-        std::cerr << "Unknown SFX!" << '\n';
-        break;
+    const int soundIndex = static_cast<int>(sfx);
+
+    if (soundIndex < 0 || soundIndex >= static_cast<int>(sounds.size())) {
+        LOG_ERROR("Unknown SFX %d!", soundIndex);
+        return;
     }
+
+    playSound(soundIndex, sfx == SFX::ticking ? -1 : 0);
+}
+
+void GameSound::playSoundFX(const std::string& name) {
+    auto it = soundIndices.find(name);
+
+    if (it == soundIndices.end()) {
+        LOG_ERROR("Unknown SFX %s!", name.c_str());
+        return;
+    }
+
+    playSound(it->second, 0);
+}
+
+void GameSound::prefetchSoundFX(const SFX& sfx) {
+    const int soundIndex = static_cast<int>(sfx);
+
+    sounds[soundIndex].holdUntilTicks = SDL_GetTicks() + PREFETCH_HOLD_MS;
+    queueLoad(soundIndex);
 }
 
 void GameSound::stopSoundFX() {
@@ -174,3 +465,28 @@ void GameSound::pauseSoundFX(const SFX& sfx) {
         }
     }
 }
+
+void GameSound::beginFrame() {
+    ++frameCounter;
+    collectFinishedLoads();
+    releaseIdleStreamedSounds();
+}
+
+const VoiceStats& GameSound::getVoiceStats() const {
+    return voiceStats;
+}
+
+int GameSound::getActiveVoiceCount() {
+    refreshChannels();
+
+    int activeVoices = 0;
+    for (const auto& playing : channelSound) {
+        if (playing != -1) ++activeVoices;
+    }
+
+    return activeVoices;
+}
+
+size_t GameSound::getLoadedBytes() const {
+    return loadedBytes;
+}
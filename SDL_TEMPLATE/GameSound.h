@@ -1,5 +1,12 @@
 #pragma once
 #include <SDL_mixer.h>
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 enum class SFX {
 	click,
@@ -15,9 +22,51 @@ enum class SFX {
 	ticking
 };
 
+constexpr int SFX_COUNT = static_cast<int>(SFX::ticking) + 1;
+
+struct VoicePolicy {
+	int maxVoices;
+	int priority; // Higher priority voices may steal channels from lower ones
+	bool stealOldest; // When maxVoices is reached, restart the oldest instance instead of dropping
+};
+
+struct VoiceStats {
+	Uint32 requested;
+	Uint32 played;
+	Uint32 dropped;
+	Uint32 deduplicated;
+	Uint32 stolen;
+};
+
+enum class SoundResidency {
+	RESIDENT, // Decoded at startup and never evicted
+	STREAMED // Decoded on demand or when prefetched, released shortly after it stops playing
+};
+
+struct SoundEntry {
+	std::string name;
+	std::string path;
+	int volume;
+	VoicePolicy policy;
+	SoundResidency residency;
+	Mix_Chunk* chunk;
+	Uint32 lastUsedTicks;
+	Uint32 lastPlayedFrame;
+	Uint32 holdUntilTicks; // A prefetched streamed sound stays loaded at least until then
+	bool loading; // Queued on or being decoded by the loader thread
+	bool failed;
+};
+
+struct FinishedLoad {
+	int soundIndex;
+	Mix_Chunk* chunk;
+	char error[256]; // Read on the loader thread, SDL errors are per thread. Fixed size so finishing a load never allocates
+};
+
 class GameSound {
 private:
 	GameSound();
+	~GameSound();
 
 public:
 	GameSound(const GameSound&) = delete;
@@ -29,21 +78,51 @@ public:
 	int tickingChannel = -1;
 
 private:
+	constexpr static const char* MANIFEST_PATH = "assets/audio/sfx.manifest";
+	constexpr static int VOICE_CHANNELS = 16;
+	constexpr static size_t MEMORY_BUDGET_BYTES = 8 * 1024 * 1024;
+	constexpr static Uint32 PREFETCH_HOLD_MS = 15000; // Longer than the longest wave countdown
+	constexpr static Uint32 STREAMED_LINGER_MS = 3000;
+
 	Mix_Music* music;
 
-	Mix_Chunk* click;
-	Mix_Chunk* minorClick;
-	Mix_Chunk* damage;
-	Mix_Chunk* fire;
-	Mix_Chunk* largeEnemySpawned;
-	Mix_Chunk* largeEnemyDead;
-	Mix_Chunk* mediumEnemyDead;
-	Mix_Chunk* normalEnemyDead;
-	Mix_Chunk* select;
-	Mix_Chunk* gameOver;
-	Mix_Chunk* ticking;
+	// The first SFX_COUNT entries are indexed by SFX, manifest-only sounds follow
+	std::vector<SoundEntry> sounds;
+	std::unordered_map<std::string, int> soundIndices;
+	size_t loadedBytes;
 
-	SFX sfx;
+	std::vector<int> channelSound; // Sound index playing on each channel, -1 when free
+	std::vector<Uint32> channelStartTicks;
+	Uint32 frameCounter;
+	VoiceStats voiceStats;
+
+	std::thread loaderThread;
+	std::mutex loaderMutex;
+	std::condition_variable loaderCondition;
+	std::deque<std::pair<int, std::string>> pendingLoads;
+	std::vector<FinishedLoad> finishedLoads; // Both reserved for every sound, a sound has at most one load in flight
+	std::vector<FinishedLoad> installingLoads;
+	bool loaderRunning;
+
+private:
+	static std::vector<SoundEntry> getDefaultSounds();
+
+	void registerSound(const SoundEntry& entry);
+	bool loadManifest();
+	void startLoader();
+	void stopLoader();
+	void loaderLoop();
+	void installChunk(int soundIndex, Mix_Chunk* chunk, const char* error);
+	void collectFinishedLoads();
+	void enforceMemoryBudget(int keepIndex);
+	void releaseChunk(int soundIndex);
+	void releaseIdleStreamedSounds();
+	void queueLoad(int soundIndex);
+	bool isSoundPlaying(int soundIndex);
+	Mix_Chunk* getChunk(int soundIndex);
+	void refreshChannels();
+	int acquireChannel(int soundIndex);
+	void playSound(int soundIndex, int loops);
 
 public:
 	void initMixer();
@@ -53,7 +132,13 @@ public:
 	void playMusic();
 	void stopMusic();
 	void playSoundFX(const SFX& sfx);
+	void playSoundFX(const std::string& name);
+	void prefetchSoundFX(const SFX& sfx);
 	void stopSoundFX();
 	void pauseSoundFX(const SFX& sfx);
-};
 
+	void beginFrame();
+	const VoiceStats& getVoiceStats() const;
+	int getActiveVoiceCount();
+	size_t getLoadedBytes() const;
+};
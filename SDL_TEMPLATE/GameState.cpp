@@ -10,6 +10,13 @@
 #include "Background.h"
 #include "MenuState.h"
 #include "GameSound.h"
+#include <algorithm>
+#include "RewindManager.h"
+#include "RenderList.h"
+#include "RenderTargetScope.h"
+#include "AppInfo.h"
+#include "Logger.h"
+#include "RenderStats.h"
 
 void GameMenu::input() {
     Menu::getInstance()->input();
@@ -23,6 +30,10 @@ void GameMenu::render() {
     Menu::getInstance()->render();
 }
 
+bool GameMenu::waitsForInput() const {
+    return true;
+}
+
 void GameTextInput::input() {
     Menu::getInstance()->input();
 }
@@ -35,6 +46,10 @@ void GameTextInput::render() {
     Menu::getInstance()->render();
 }
 
+bool GameTextInput::waitsForInput() const {
+    return true;
+}
+
 struct StateVector {
     float x;
     float y;
@@ -49,6 +64,7 @@ void GamePlaying::input() {
         case SDLK_w: InvokerPlaying::getInstance()->pressButton(Command_Actions::moveUp); break;
         case SDLK_d: InvokerPlaying::getInstance()->pressButton(Command_Actions::moveRight); break;
         case SDLK_s: InvokerPlaying::getInstance()->pressButton(Command_Actions::moveDown); break;
+        case SDLK_r: RewindManager::getInstance()->rewind(); break;
         case SDLK_ESCAPE: 
             Game::getInstance()->setState(std::make_unique<GamePaused>());
             Menu::getInstance()->setState(std::make_unique<PausedMenu>());
@@ -126,7 +142,7 @@ void GamePlaying::input() {
 }
 
 
-void GamePlaying::update() {
+void GamePlaying::updateWorld() {
     InvokerPlaying::getInstance()->updatePlayers();
 
     Bullet::bullets.erase(
@@ -145,6 +161,10 @@ void GamePlaying::update() {
     }
 
     WaveManager::getInstance()->update();
+}
+
+void GamePlaying::update() {
+    updateWorld();
 
     if (WaveManager::getInstance()->isWaveFinish()) {
         if (!WaveManager::getInstance()->hasCountdownStarted()) {
@@ -152,7 +172,6 @@ void GamePlaying::update() {
             WaveManager::getInstance()->decreasePlayersFiringCooldown();
 
             WaveManager::getInstance()->incrementWave();
-            WaveManager::getInstance()->updateWaveCountText();
         }
 
         if (WaveManager::getInstance()->isCountdownFinish()) {
@@ -161,49 +180,85 @@ void GamePlaying::update() {
         }
     }
 
-    Minimap::getInstance()->update();
+    RewindManager::getInstance()->tick();
 }
 
-
+// Draws the latest render list published by the simulation thread, never the live world
 void GamePlaying::render() {
-    Background::getInstance()->render();
-    InvokerPlaying::getInstance()->renderPlayers();
+    const RenderList& renderList = Game::getInstance()->getRenderBuffers()->getFront();
 
-    for (const auto& bullet : Bullet::bullets) {
-        bullet->render();
-    }
+    Background::getInstance()->render(renderList.backgroundSrcRect);
+    InvokerPlaying::getInstance()->renderPlayers(renderList.players);
+    renderList.renderSprites(renderList.bullets);
+    renderList.renderSprites(renderList.enemies);
 
-    WaveManager::getInstance()->render();
-    InvokerPlaying::getInstance()->renderPlayerProfiles();
-    Minimap::getInstance()->render();
+    WaveManager::getInstance()->render(renderList.hud);
+    Game::getInstance()->renderPlayerProfiles(renderList.players);
+    Minimap::getInstance()->render(renderList.minimap);
 }
 
-void GamePaused::input() {
-    Menu::getInstance()->input();
+bool GamePlaying::runsOnSimulationThread() const {
+    return true;
 }
 
-void GamePaused::update() {
-    Menu::getInstance()->update();
-}
+void GameFrozen::captureStaticLayer() {
+    SDL_Renderer* renderer = Game::getInstance()->getRenderer();
+    staticLayerMenu = Menu::getInstance()->currentState.get();
+
+    if (!SDL_RenderTargetSupported(renderer)) return;
+
+    if (!staticLayer) {
+        staticLayer.reset(SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, SCREEN_WIDTH, SCREEN_HEIGHT));
+        if (!staticLayer) {
+            LOG_WARNING("Failed to create frozen frame texture, drawing it live: %s", SDL_GetError());
+            return;
+        }
+    }
+
+    RenderTargetScope target(renderer, staticLayer.get());
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+    SDL_RenderClear(renderer);
 
-void GamePaused::render() {
     GamePlaying playing;
     playing.render();
-
-    Menu::getInstance()->render();
+    Menu::getInstance()->renderStatic();
 }
 
-void GameOver::input() {
+void GameFrozen::input() {
+    // Target textures lose their content when the device is reset
+    const Uint32 eventType = Game::getInstance()->getEvent().type;
+    if (eventType == SDL_RENDER_TARGETS_RESET || eventType == SDL_RENDER_DEVICE_RESET) {
+        staticLayer.reset();
+        staticLayerMenu = nullptr;
+    }
+
     Menu::getInstance()->input();
 }
 
-void GameOver::update() {
+void GameFrozen::update() {
     Menu::getInstance()->update();
 }
 
-void GameOver::render() {
-    GamePlaying playing;
-    playing.render();
+void GameFrozen::render() {
+    if (!staticLayerMenu || staticLayerMenu != Menu::getInstance()->currentState.get()) captureStaticLayer();
 
-    Menu::getInstance()->render();
-}
\ No newline at end of file
+    // Without target support everything is drawn live, like any other frame
+    if (!staticLayer) {
+        GamePlaying playing;
+        playing.render();
+        Menu::getInstance()->render();
+        return;
+    }
+
+    SDL_RenderCopy(Game::getInstance()->getRenderer(), staticLayer.get(), nullptr, nullptr);
+    RenderStats::countDrawCalls(1);
+    Menu::getInstance()->renderDynamic();
+}
+
+bool GameFrozen::waitsForInput() const {
+    return true;
+}
+
+bool GamePaused::pausesGameClock() const {
+    return true;
+}
@@ -1,4 +1,9 @@
 #pragma once
+#include <SDL.h>
+#include <memory>
+
+class MenuState;
+
 class GameState {
 public:
 	virtual ~GameState() = default;
@@ -6,6 +11,15 @@ public:
 	virtual void input() = 0;
 	virtual void update() = 0;
 	virtual void render() = 0;
+
+	// Updated on the simulation thread and drawn from render lists
+	virtual bool runsOnSimulationThread() const { return false; }
+
+	// Game time, and every countdown and cooldown on it, stands still while this state is active
+	virtual bool pausesGameClock() const { return false; }
+
+	// Nothing moves without input, so the loop sleeps on the event queue and skips update and render between events
+	virtual bool waitsForInput() const { return false; }
 };
 
 class GameMenu : public GameState {
@@ -13,6 +27,7 @@ public:
 	void input() override;
 	void update() override;
 	void render() override;
+	bool waitsForInput() const override;
 };
 
 class GameTextInput : public GameState {
@@ -20,25 +35,41 @@ public:
 	void input() override;
 	void update() override;
 	void render() override;
+	bool waitsForInput() const override;
 };
 
 class GamePlaying : public GameState {
+protected:
+	// Players, bullets and enemies, without wave progression or rewind history
+	void updateWorld();
+
 public:
 	void input() override;
 	void update() override;
 	void render() override;
+	bool runsOnSimulationThread() const override;
 };
 
-class GamePaused : public GameState {
+// Pause and game over show a world that no longer moves. The scene and the static part of the menu are composed
+// into one texture on the first frame, later frames copy it and draw only the menu's dynamic part on top.
+class GameFrozen : public GameState {
+private:
+	std::unique_ptr<SDL_Texture, decltype(&SDL_DestroyTexture)> staticLayer { nullptr, SDL_DestroyTexture };
+	const MenuState* staticLayerMenu = nullptr; // Menu the layer was composed with
+
+private:
+	void captureStaticLayer();
+
 public:
 	void input() override;
 	void update() override;
 	void render() override;
+	bool waitsForInput() const override;
 };
 
-class GameOver : public GameState {
+class GamePaused : public GameFrozen {
 public:
-	void input() override;
-	void update() override;
-	void render() override;
-};
\ No newline at end of file
+	bool pausesGameClock() const override;
+};
+
+class GameOver : public GameFrozen {};
\ No newline at end of file
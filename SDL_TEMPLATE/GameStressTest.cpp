@@ -0,0 +1,255 @@
+#include "GameStressTest.h"
+#include "Game.h"
+#include "GameClock.h"
+#include "GameRandom.h"
+#include "GameSound.h"
+#include "InvokerPlaying.h"
+#include "Player.h"
+#include "Bullet.h"
+#include "World.h"
+#include "WaveManager.h"
+#include "WorldSnapshot.h"
+#include "Menu.h"
+#include "MenuState.h"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+
+namespace {
+	constexpr int ARCHETYPE_COUNT = 7;
+	constexpr Prototype_Type ARCHETYPES[ARCHETYPE_COUNT] = {
+		Prototype_Type::NORMAL_ENEMY,
+		Prototype_Type::NORMAL_ENEMY_FAST,
+		Prototype_Type::MEDIUM_ENEMY,
+		Prototype_Type::MEDIUM_ENEMY_FAST,
+		Prototype_Type::LARGE_ENEMY,
+		Prototype_Type::LARGE_ENEMY_FAST,
+		Prototype_Type::BULLET // Ramps synthetic players, the count is the live bullets they keep in the air
+	};
+
+	constexpr double DEFAULT_FRAME_BUDGET_MS = 1000.0 / 60.0 * 1.1; // A dropped vsync shows up well above this
+	constexpr int DEFAULT_START_COUNT = 50;
+	constexpr int DEFAULT_FIRE_RATE = 10;
+	constexpr int BULLET_WARMUP_FRAMES = 180; // Bullets live a few seconds, so their count takes longer to level off
+}
+
+StressConfig StressConfig::parse(int argc, char* argv[]) {
+	StressConfig config = { DEFAULT_FRAME_BUDGET_MS, DEFAULT_START_COUNT, DEFAULT_FIRE_RATE, "stress_results.json" };
+
+	for (int argIndex = 1; argIndex < argc; argIndex++) {
+		const char* arg = argv[argIndex];
+
+		if (std::strncmp(arg, "--stress_budget_ms=", 19) == 0) config.frameBudgetMs = std::atof(arg + 19);
+		else if (std::strncmp(arg, "--stress_start=", 15) == 0) config.startCount = std::atoi(arg + 15);
+		else if (std::strncmp(arg, "--stress_fire_rate=", 19) == 0) config.fireRate = std::atoi(arg + 19);
+		else if (std::strncmp(arg, "--stress_out=", 13) == 0) config.outPath = arg + 13;
+	}
+
+	if (config.startCount < 1) config.startCount = 1;
+	if (config.fireRate < 1) config.fireRate = 1;
+	return config;
+}
+
+GameStressTest::GameStressTest(const StressConfig& config)
+	: config(config), archetypeIndex(0), targetCount(0), stageFrame(0), stageFrameNs(0), lastUpdateNs(0), peakBulletCount(0) {
+	std::cout << "Stress test: " << config.frameBudgetMs << " ms budget, starting at " << config.startCount << '\n';
+
+	results.push_back({ ARCHETYPES[0], 0, 0.0, 0, 0.0 });
+	startStage(config.startCount);
+}
+
+const char* GameStressTest::getTypeName(Prototype_Type type) {
+	switch (type) {
+	case Prototype_Type::PLAYER: return "PLAYER";
+	case Prototype_Type::BULLET: return "BULLET";
+	case Prototype_Type::NORMAL_ENEMY: return "NORMAL_ENEMY";
+	case Prototype_Type::NORMAL_ENEMY_FAST: return "NORMAL_ENEMY_FAST";
+	case Prototype_Type::MEDIUM_ENEMY: return "MEDIUM_ENEMY";
+	case Prototype_Type::MEDIUM_ENEMY_FAST: return "MEDIUM_ENEMY_FAST";
+	case Prototype_Type::LARGE_ENEMY: return "LARGE_ENEMY";
+	case Prototype_Type::LARGE_ENEMY_FAST: return "LARGE_ENEMY_FAST";
+	}
+	return "UNKNOWN";
+}
+
+bool GameStressTest::isBulletStage() const {
+	return ARCHETYPES[archetypeIndex] == Prototype_Type::BULLET;
+}
+
+int GameStressTest::getLoadCount() const {
+	if (isBulletStage()) return peakBulletCount;
+	return static_cast<int>(WaveManager::getInstance()->getEnemies().size());
+}
+
+// Enemies keep touching the player, a game over would end the run halfway
+void GameStressTest::keepPlayersAlive() {
+	for (auto& player : InvokerPlaying::getInstance()->players) {
+		*player.second->heartAmount = *player.second->maxHeartAmount;
+	}
+}
+
+void GameStressTest::topUpEnemies() {
+	const int missing = targetCount - static_cast<int>(WaveManager::getInstance()->getEnemies().size());
+	if (missing > 0) WaveManager::getInstance()->spawnEnemies(ARCHETYPES[archetypeIndex], missing);
+}
+
+// Shots are owned by the real player, so they collide and score exactly like its own
+void GameStressTest::fireSyntheticPlayers() {
+	auto& players = InvokerPlaying::getInstance()->players;
+	if (players.empty()) return;
+
+	Player& owner = *players.begin()->second;
+	const Uint32 cooldownMs = 1000 / static_cast<Uint32>(config.fireRate);
+
+	for (auto& syntheticPlayer : syntheticPlayers) {
+		if (!syntheticPlayer.firingTimer.tryTrigger(cooldownMs)) continue;
+
+		syntheticPlayer.angle += SPRAY_STEP;
+
+		BulletSnapshot bullet;
+		bullet.playerID = owner.getID();
+		bullet.position = syntheticPlayer.position;
+		bullet.directionX = std::cos(syntheticPlayer.angle);
+		bullet.directionY = std::sin(syntheticPlayer.angle);
+		owner.restoreBullet(bullet);
+	}
+}
+
+void GameStressTest::resizeSyntheticPlayers(int count) {
+	const SDL_Point& worldDimension = World::getInstance()->getDimension();
+	std::mt19937& rng = GameRandom::getEngine();
+
+	std::uniform_int_distribution<int> distX(BORDER_ALLOWANCE * 2, worldDimension.x - BORDER_ALLOWANCE * 2 - Bullet::BULLET_DIMENSION.x);
+	std::uniform_int_distribution<int> distY(BORDER_ALLOWANCE * 2, worldDimension.y - BORDER_ALLOWANCE * 2 - Bullet::BULLET_DIMENSION.y);
+	std::uniform_real_distribution<float> distAngle(0.0F, 6.2831853F);
+
+	while (static_cast<int>(syntheticPlayers.size()) < count) {
+		syntheticPlayers.push_back({ { distX(rng), distY(rng) }, distAngle(rng), Cooldown() });
+	}
+}
+
+void GameStressTest::startStage(int count) {
+	targetCount = count;
+	stageFrame = 0;
+	stageFrameNs = 0;
+	peakBulletCount = 0;
+
+	if (isBulletStage()) resizeSyntheticPlayers(count);
+}
+
+void GameStressTest::finishStage() {
+	const double frameMs = static_cast<double>(stageFrameNs) / GameClock::NANOSECONDS_PER_MILLISECOND / SAMPLE_FRAMES;
+	const int loadCount = getLoadCount();
+	ArchetypeResult& result = results.back();
+
+	std::cout << "  " << getTypeName(result.type) << " " << loadCount << ": " << frameMs << " ms" << '\n';
+
+	if (frameMs <= config.frameBudgetMs) {
+		result.sustainedCount = loadCount;
+		result.sustainedFrameMs = frameMs;
+
+		const int grownCount = static_cast<int>(targetCount * GROWTH_FACTOR);
+		const int nextCount = grownCount > targetCount ? grownCount : targetCount + 1;
+
+		if (nextCount <= MAX_COUNT) {
+			startStage(nextCount);
+			return;
+		}
+	} else {
+		result.failedCount = loadCount;
+		result.failedFrameMs = frameMs;
+	}
+
+	clearLoad();
+
+	if (++archetypeIndex < ARCHETYPE_COUNT) {
+		results.push_back({ ARCHETYPES[archetypeIndex], 0, 0.0, 0, 0.0 });
+		startStage(config.startCount);
+	} else {
+		finish();
+	}
+}
+
+void GameStressTest::clearLoad() {
+	WaveManager::getInstance()->clearEnemies();
+	Bullet::bullets.clear();
+	syntheticPlayers.clear();
+}
+
+void GameStressTest::finish() {
+	archetypeIndex = ARCHETYPE_COUNT;
+
+	std::cout << "Stress test: max sustainable count within " << config.frameBudgetMs << " ms" << '\n';
+	for (const auto& result : results) {
+		std::cout << "  " << getTypeName(result.type) << ": " << result.sustainedCount << '\n';
+	}
+
+	if (writeJson()) std::cout << "Stress results written to " << config.outPath << '\n';
+	else std::cerr << "Failed to open stress output " << config.outPath << '\n';
+
+	// Called from the simulation tick, the menu and music belong to the main thread
+	Game::getInstance()->runOnMainThread([] {
+		GameSound::getInstance()->playMusic();
+		Game::getInstance()->setState(std::make_unique<GameMenu>());
+		Menu::getInstance()->setState(std::make_unique<MainMenu>());
+	});
+}
+
+bool GameStressTest::writeJson() const {
+	std::ofstream out(config.outPath);
+	if (!out) return false;
+
+	out << "{\n  \"frame_budget_ms\": " << config.frameBudgetMs << ",\n  \"fire_rate\": " << config.fireRate;
+	out << ",\n  \"archetypes\": [";
+
+	for (size_t resultIndex = 0; resultIndex < results.size(); resultIndex++) {
+		const ArchetypeResult& result = results[resultIndex];
+
+		out << (resultIndex == 0 ? "\n" : ",\n") << "    { \"type\": \"" << getTypeName(result.type)
+			<< "\", \"sustained_count\": " << result.sustainedCount << ", \"sustained_frame_ms\": " << result.sustainedFrameMs
+			<< ", \"failed_count\": " << result.failedCount << ", \"failed_frame_ms\": " << result.failedFrameMs << " }";
+	}
+
+	out << "\n  ]\n}\n";
+	return true;
+}
+
+// Escape ends the run early and still reports what was reached
+void GameStressTest::input() {
+	const SDL_Event& event = Game::getInstance()->getEvent();
+
+	if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_ESCAPE) {
+		if (archetypeIndex < ARCHETYPE_COUNT) {
+			clearLoad();
+			finish();
+		}
+		return;
+	}
+
+	GamePlaying::input();
+}
+
+// Frame time is the real time between two ticks, one tick per frame, so it covers render and present as well
+void GameStressTest::update() {
+	if (archetypeIndex >= ARCHETYPE_COUNT) return;
+
+	const Uint64 now = GameClock::getRealTimeNs();
+	const int warmupFrames = isBulletStage() ? BULLET_WARMUP_FRAMES : WARMUP_FRAMES;
+
+	if (lastUpdateNs != 0 && stageFrame > warmupFrames) stageFrameNs += now - lastUpdateNs;
+	lastUpdateNs = now;
+
+	keepPlayersAlive();
+	if (isBulletStage()) fireSyntheticPlayers();
+	else topUpEnemies();
+
+	updateWorld();
+
+	const int bulletCount = static_cast<int>(Bullet::bullets.size());
+	if (bulletCount > peakBulletCount) peakBulletCount = bulletCount;
+
+	if (++stageFrame > warmupFrames + SAMPLE_FRAMES) finishStage();
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <SDL.h>
+#include <vector>
+#include "GameState.h"
+#include "GameEnums.h"
+#include "Cooldown.h"
+
+struct StressConfig {
+	double frameBudgetMs; // A stage fails once its mean frame time goes over this
+	int startCount;
+	int fireRate; // Shots per second from every synthetic player
+	const char* outPath;
+
+	// Understands --stress_budget_ms=<ms>, --stress_start=<count>, --stress_fire_rate=<shots per second> and --stress_out=<path>
+	static StressConfig parse(int argc, char* argv[]);
+};
+
+// Debug state that loads one archetype at a time, enemies topped up through WaveManager and bullets from synthetic
+// players firing at a set rate, and grows the load until the frame time goes over budget.
+// Reports the largest count that held the budget per archetype, then drops back to the main menu.
+class GameStressTest : public GamePlaying {
+private:
+	constexpr static int WARMUP_FRAMES = 20; // Spawn hitches and cache warmup stay out of the sample
+	constexpr static int SAMPLE_FRAMES = 60;
+	constexpr static float GROWTH_FACTOR = 1.25F;
+	constexpr static int MAX_COUNT = 100000; // Stops an archetype that never breaks the budget
+	constexpr static float SPRAY_STEP = 0.35F; // Radians a synthetic player turns between shots
+
+	struct SyntheticPlayer {
+		SDL_Point position;
+		float angle;
+		Cooldown firingTimer;
+	};
+
+	struct ArchetypeResult {
+		Prototype_Type type;
+		int sustainedCount;
+		double sustainedFrameMs;
+		int failedCount;
+		double failedFrameMs;
+	};
+
+private:
+	StressConfig config;
+	size_t archetypeIndex;
+	int targetCount;
+	int stageFrame;
+	Uint64 stageFrameNs;
+	Uint64 lastUpdateNs;
+	int peakBulletCount;
+	std::vector<SyntheticPlayer> syntheticPlayers;
+	std::vector<ArchetypeResult> results;
+
+private:
+	static const char* getTypeName(Prototype_Type type);
+
+	bool isBulletStage() const;
+	int getLoadCount() const;
+	void keepPlayersAlive();
+	void topUpEnemies();
+	void fireSyntheticPlayers();
+	void resizeSyntheticPlayers(int count);
+	void startStage(int count);
+	void finishStage();
+	void clearLoad();
+	void finish();
+	bool writeJson() const;
+
+public:
+	explicit GameStressTest(const StressConfig& config);
+
+	void input() override;
+	void update() override;
+};
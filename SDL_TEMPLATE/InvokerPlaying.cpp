@@ -1,6 +1,7 @@
 #include "InvokerPlaying.h"
 #include "Command.h"
 #include "Player.h"
+#include "RenderList.h"
 
 InvokerPlaying::InvokerPlaying() {}
 
@@ -39,14 +40,8 @@ void InvokerPlaying::updatePlayers() {
 	}
 }
 
-void InvokerPlaying::renderPlayers() {
-	for (auto& player : players) {
-		player.second->render();
+void InvokerPlaying::renderPlayers(const std::vector<PlayerRenderState>& playerStates) {
+	for (const auto& playerState : playerStates) {
+		playerState.player->render(playerState);
 	}
 }
-
-void InvokerPlaying::renderPlayerProfiles() {
-	for (auto& player : players) {
-		player.second->renderPlayerProfiles();
-	}
-}
\ No newline at end of file
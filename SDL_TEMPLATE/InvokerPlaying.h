@@ -2,9 +2,11 @@
 #include <unordered_map>
 #include <SDL.h>
 #include <memory>
+#include <vector>
 #include "Player.h"
 
 class Command;
+struct PlayerRenderState;
 
 enum class Command_Actions {
 	moveLeft,
@@ -63,6 +65,6 @@ public:
 
 	void pressButton(Command_Actions commandAction);
 	void updatePlayers();
-	void renderPlayers();
-	void renderPlayerProfiles();
+	// Draw from the render list alone, the player map may be changing on the simulation thread
+	void renderPlayers(const std::vector<PlayerRenderState>& playerStates);
 };
\ No newline at end of file
@@ -0,0 +1,140 @@
+#include "JobSystem.h"
+#include <algorithm>
+
+JobSystem::JobSystem(unsigned workerCount) : running(true), queuedJobs(0), unfinishedJobs(0) {
+	if (workerCount > MAX_WORKERS) workerCount = MAX_WORKERS;
+
+	for (unsigned queueIndex = 0; queueIndex <= workerCount; queueIndex++) {
+		queues.push_back(std::make_unique<WorkQueue>());
+	}
+
+	for (unsigned workerIndex = 0; workerIndex < workerCount; workerIndex++) {
+		workers.emplace_back(&JobSystem::workerLoop, this, workerIndex);
+	}
+}
+
+JobSystem::~JobSystem() {
+	{
+		std::lock_guard<std::mutex> lock(wakeMutex);
+		running = false;
+	}
+	wakeCondition.notify_all();
+
+	for (auto& worker : workers) {
+		worker.join();
+	}
+}
+
+unsigned JobSystem::getDefaultWorkerCount() {
+	unsigned hardwareThreads = std::thread::hardware_concurrency();
+	if (hardwareThreads <= 1) return 0;
+
+	return hardwareThreads - 1 > MAX_WORKERS ? MAX_WORKERS : hardwareThreads - 1;
+}
+
+size_t JobSystem::getChunkCount(size_t count, size_t chunkSize) {
+	return chunkSize == 0 ? 0 : (count + chunkSize - 1) / chunkSize;
+}
+
+void JobSystem::push(size_t queueIndex, const Job& job) {
+	{
+		std::lock_guard<std::mutex> lock(queues[queueIndex]->mutex);
+		queues[queueIndex]->jobs.push_back(job);
+	}
+
+	++queuedJobs;
+}
+
+bool JobSystem::popOwn(size_t queueIndex, Job& job) {
+	WorkQueue& queue = *queues[queueIndex];
+	std::lock_guard<std::mutex> lock(queue.mutex);
+
+	if (queue.jobs.size() == queue.head) return false;
+
+	job = queue.jobs.back();
+	queue.jobs.pop_back();
+	if (queue.jobs.size() == queue.head) {
+		queue.jobs.clear();
+		queue.head = 0;
+	}
+
+	--queuedJobs;
+	return true;
+}
+
+bool JobSystem::steal(size_t thiefIndex, Job& job) {
+	for (size_t offset = 1; offset < queues.size(); offset++) {
+		WorkQueue& victim = *queues[(thiefIndex + offset) % queues.size()];
+		std::lock_guard<std::mutex> lock(victim.mutex);
+
+		if (victim.jobs.size() == victim.head) continue;
+
+		// Steal from the opposite end the owner pops from
+		job = victim.jobs[victim.head++];
+		if (victim.jobs.size() == victim.head) {
+			victim.jobs.clear();
+			victim.head = 0;
+		}
+
+		--queuedJobs;
+		return true;
+	}
+
+	return false;
+}
+
+bool JobSystem::runOne(size_t queueIndex) {
+	Job job;
+
+	if (!popOwn(queueIndex, job) && !steal(queueIndex, job)) return false;
+
+	(*job.body)(job.begin, job.end, job.chunkIndex);
+	--unfinishedJobs;
+	return true;
+}
+
+void JobSystem::workerLoop(size_t queueIndex) {
+	while (true) {
+		if (runOne(queueIndex)) continue;
+
+		std::unique_lock<std::mutex> lock(wakeMutex);
+		wakeCondition.wait(lock, [this] { return !running || queuedJobs > 0; });
+
+		if (!running) return;
+	}
+}
+
+void JobSystem::parallelFor(size_t count, size_t chunkSize, const ChunkBody& body) {
+	const size_t chunkCount = getChunkCount(count, chunkSize);
+
+	// Nothing to share, run inline in chunk order
+	if (workers.empty() || chunkCount <= 1) {
+		for (size_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++) {
+			body(chunkIndex * chunkSize, std::min(count, (chunkIndex + 1) * chunkSize), chunkIndex);
+		}
+		return;
+	}
+
+	unfinishedJobs += static_cast<int>(chunkCount);
+
+	for (size_t chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++) {
+		const size_t begin = chunkIndex * chunkSize;
+		const size_t end = std::min(count, begin + chunkSize);
+
+		push(chunkIndex % queues.size(), { &body, begin, end, chunkIndex });
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(wakeMutex);
+	}
+	wakeCondition.notify_all();
+
+	const size_t callerQueue = queues.size() - 1;
+	while (unfinishedJobs > 0) {
+		if (!runOne(callerQueue)) std::this_thread::yield();
+	}
+}
+
+unsigned JobSystem::getWorkerCount() const {
+	return static_cast<unsigned>(workers.size());
+}
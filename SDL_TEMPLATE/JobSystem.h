@@ -0,0 +1,67 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Small work-stealing pool, the calling thread always takes part in its own parallelFor
+class JobSystem {
+public:
+	using ChunkBody = std::function<void(size_t begin, size_t end, size_t chunkIndex)>;
+
+	explicit JobSystem(unsigned workerCount);
+	~JobSystem();
+
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+	JobSystem(JobSystem&&) = delete;
+	JobSystem& operator=(JobSystem&&) = delete;
+
+	constexpr static unsigned MAX_WORKERS = 7;
+
+private:
+	// Plain data so queuing a chunk never allocates, the body outlives every job of its parallelFor
+	struct Job {
+		const ChunkBody* body;
+		size_t begin;
+		size_t end;
+		size_t chunkIndex;
+	};
+
+	// Owner pops from the back, thieves take from head. Cleared once drained so the capacity is reused.
+	struct WorkQueue {
+		std::mutex mutex;
+		std::vector<Job> jobs;
+		size_t head = 0;
+	};
+
+	// One queue per worker, the last one belongs to the thread calling parallelFor
+	std::vector<std::unique_ptr<WorkQueue>> queues;
+	std::vector<std::thread> workers;
+
+	std::atomic<bool> running;
+	std::atomic<int> queuedJobs;
+	std::atomic<int> unfinishedJobs;
+
+	std::mutex wakeMutex;
+	std::condition_variable wakeCondition;
+
+private:
+	void push(size_t queueIndex, const Job& job);
+	bool popOwn(size_t queueIndex, Job& job);
+	bool steal(size_t thiefIndex, Job& job);
+	bool runOne(size_t queueIndex);
+	void workerLoop(size_t queueIndex);
+
+public:
+	static unsigned getDefaultWorkerCount();
+	static size_t getChunkCount(size_t count, size_t chunkSize);
+
+	// Splits [0, count) into fixed chunks so chunkIndex is the same no matter which thread runs it
+	void parallelFor(size_t count, size_t chunkSize, const ChunkBody& body);
+
+	unsigned getWorkerCount() const;
+};
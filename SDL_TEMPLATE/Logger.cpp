@@ -0,0 +1,136 @@
+#include "Logger.h"
+#include "GameClock.h"
+#include <cstdarg>
+#include <cstdio>
+
+Logger::Logger() : ring(RING_CAPACITY), ringHead(0), ringCount(0), dropped(0), repeatSlots(), running(true) {
+	writerThread = std::thread(&Logger::writerLoop, this);
+}
+
+Logger::~Logger() {
+	shutdown();
+}
+
+Logger* Logger::getInstance() {
+	static Logger instance;
+	return &instance;
+}
+
+// FNV-1a over the level and the formatted text
+Uint32 Logger::hashMessage(Log_Level level, const char* message) {
+	Uint32 hash = 2166136261U ^ static_cast<Uint32>(level);
+
+	for (const char* character = message; *character; character++) {
+		hash ^= static_cast<Uint8>(*character);
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+const char* Logger::getLevelName(Log_Level level) {
+	switch (level) {
+	case Log_Level::debug: return "DEBUG";
+	case Log_Level::info: return "INFO";
+	case Log_Level::warning: return "WARNING";
+	case Log_Level::error: return "ERROR";
+	}
+	return "LOG";
+}
+
+void Logger::writeEntry(const Entry& entry) {
+	FILE* stream = entry.level >= Log_Level::warning ? stderr : stdout;
+
+	if (entry.repeats > 0) {
+		std::fprintf(stream, "[%s] %s (repeated %u times)\n", getLevelName(entry.level), entry.message, entry.repeats);
+	} else {
+		std::fprintf(stream, "[%s] %s\n", getLevelName(entry.level), entry.message);
+	}
+}
+
+void Logger::log(Log_Level level, const char* format, ...) {
+	Entry entry;
+	entry.level = level;
+	entry.repeats = 0;
+
+	va_list arguments;
+	va_start(arguments, format);
+	SDL_vsnprintf(entry.message, sizeof(entry.message), format, arguments);
+	va_end(arguments);
+
+	const Uint32 hash = hashMessage(level, entry.message);
+	const Uint64 nowMs = GameClock::getRealTimeNs() / GameClock::NANOSECONDS_PER_MILLISECOND;
+
+	std::unique_lock<std::mutex> lock(mutex);
+
+	RepeatSlot& slot = repeatSlots[hash % REPEAT_SLOT_COUNT];
+	if (slot.hash == hash && slot.lastWrittenMs != 0 && nowMs - slot.lastWrittenMs < REPEAT_WINDOW_MS) {
+		slot.repeats++;
+		return;
+	}
+
+	if (slot.hash == hash) entry.repeats = slot.repeats;
+	slot = { hash, nowMs, 0 };
+
+	if (!running) {
+		lock.unlock();
+		writeEntry(entry);
+		return;
+	}
+
+	if (ringCount == RING_CAPACITY) {
+		dropped++;
+		return;
+	}
+
+	ring[(ringHead + ringCount) % RING_CAPACITY] = entry;
+	ringCount++;
+
+	lock.unlock();
+	condition.notify_one();
+}
+
+void Logger::writerLoop() {
+	Entry entry;
+
+	std::unique_lock<std::mutex> lock(mutex);
+
+	for (;;) {
+		condition.wait(lock, [this] { return ringCount > 0 || dropped > 0 || !running; });
+
+		if (dropped > 0) {
+			const Uint32 droppedCount = dropped;
+			dropped = 0;
+
+			lock.unlock();
+			std::fprintf(stderr, "[WARNING] Log ring full, %u messages dropped\n", droppedCount);
+			lock.lock();
+		}
+
+		while (ringCount > 0) {
+			entry = ring[ringHead];
+			ringHead = (ringHead + 1) % RING_CAPACITY;
+			ringCount--;
+
+			// The console write is the slow part, producers keep queueing meanwhile
+			lock.unlock();
+			writeEntry(entry);
+			lock.lock();
+		}
+
+		std::fflush(stdout);
+
+		if (!running && ringCount == 0) break;
+	}
+}
+
+void Logger::shutdown() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!running) return;
+		running = false;
+	}
+
+	condition.notify_one();
+	writerThread.join();
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include <SDL.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+enum class Log_Level {
+	debug,
+	info,
+	warning,
+	error
+};
+
+// Leveled logger that formats on the calling thread and writes to the console from its own thread, so a broken asset
+// logging every frame costs a copy into a ring buffer instead of a console write. The same message repeated within
+// REPEAT_WINDOW_MS is counted rather than queued, and a full ring drops messages instead of blocking.
+class Logger {
+private:
+	Logger();
+	~Logger();
+
+public:
+	Logger(const Logger&) = delete;
+	Logger& operator=(const Logger&) = delete;
+	Logger(Logger&&) = delete;
+	Logger& operator=(Logger&&) = delete;
+
+	static Logger* getInstance();
+
+private:
+	constexpr static size_t RING_CAPACITY = 256;
+	constexpr static int MESSAGE_CAPACITY = 256;
+	constexpr static Uint32 REPEAT_WINDOW_MS = 1000;
+	constexpr static size_t REPEAT_SLOT_COUNT = 64; // Direct-mapped by message hash, a collision just forgets a count
+
+	struct Entry {
+		Log_Level level;
+		Uint32 repeats; // Suppressed copies of this message since it was last written
+		char message[MESSAGE_CAPACITY];
+	};
+
+	struct RepeatSlot {
+		Uint32 hash;
+		Uint64 lastWrittenMs;
+		Uint32 repeats;
+	};
+
+	std::vector<Entry> ring;
+	size_t ringHead;
+	size_t ringCount;
+	Uint32 dropped;
+	RepeatSlot repeatSlots[REPEAT_SLOT_COUNT];
+
+	std::thread writerThread;
+	std::mutex mutex;
+	std::condition_variable condition;
+	bool running;
+
+private:
+	static Uint32 hashMessage(Log_Level level, const char* message);
+	static const char* getLevelName(Log_Level level);
+	static void writeEntry(const Entry& entry);
+	void writerLoop();
+
+public:
+	void log(Log_Level level, SDL_PRINTF_FORMAT_STRING const char* format, ...) SDL_PRINTF_VARARG_FUNC(3);
+
+	// Writes what is queued and stops the writer thread, later messages are written synchronously
+	void shutdown();
+};
+
+// Debug messages and their arguments are compiled out of release builds
+#ifdef _DEBUG
+#define LOG_DEBUG(...) Logger::getInstance()->log(Log_Level::debug, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...) ((void)0)
+#endif
+
+#define LOG_INFO(...) Logger::getInstance()->log(Log_Level::info, __VA_ARGS__)
+#define LOG_WARNING(...) Logger::getInstance()->log(Log_Level::warning, __VA_ARGS__)
+#define LOG_ERROR(...) Logger::getInstance()->log(Log_Level::error, __VA_ARGS__)
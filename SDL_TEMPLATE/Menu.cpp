@@ -1,4 +1,3 @@
-#include <iostream>
 #include <SDL_image.h>
 #include "Menu.h"
 #include "MenuState.h"
@@ -6,6 +5,7 @@
 #include "Text.h"
 #include "Player.h"
 #include "AppInfo.h"
+#include "Logger.h"
 
 std::string Menu::tempPlayerNamme = " ";
 
@@ -33,11 +33,11 @@ void Menu::initTexture(
 	SDL_Texture* rawTexture = IMG_LoadTexture(Game::getInstance()->getRenderer(), filePath);
 
 	if (!rawTexture) {
-		std::cerr << "Failed to create texture from file " << filePath << ": " << SDL_GetError() << '\n';
+		LOG_ERROR("Failed to create texture from file %s: %s", filePath, SDL_GetError());
 		return;
 	}
 
-	std::cout << "Texture loaded from path: " << filePath << '\n';
+	LOG_DEBUG("Texture loaded from path: %s", filePath);
 	texture.reset(rawTexture);
 
 	dimension = std::make_unique<SDL_Point>();
@@ -130,4 +130,12 @@ void Menu::update() {
 
 void Menu::render() {
 	currentState->render();
+}
+
+void Menu::renderStatic() {
+	currentState->renderStatic();
+}
+
+void Menu::renderDynamic() {
+	currentState->renderDynamic();
 }
\ No newline at end of file
@@ -94,5 +94,7 @@ public:
     void input();
     void update();
     void render();
+    void renderStatic();
+    void renderDynamic();
 };
 
@@ -7,12 +7,12 @@
 #include "BorderManager.h"
 #include "WaveManager.h"
 #include "GameSound.h"
+#include "RenderStats.h"
 #include <iostream>
 
 void MainMenu::input() {
 	static int previousState = -1; 
 	int currentState = -1;
-	static bool playMusic = true;
 
 	MouseStateFlags* mouseFlags = Menu::getInstance()->mouseStateFlags.get();
 	MainMenuFlags* menuFlags = Menu::getInstance()->mainMenuFlags.get();
@@ -115,6 +115,7 @@ void MainMenu::render() {
 		Menu::getInstance()->menuBackgroundDimension->x / 2, Menu::getInstance()->menuBackgroundDimension->y };
 
 	SDL_RenderCopy(Game::getInstance()->getRenderer(), Menu::getInstance()->mTextureMenu.get(), &srcRect, nullptr );
+	RenderStats::countDrawCalls(1);
 	Selector::getInstance()->render();
 
 	/*
@@ -131,7 +132,6 @@ void MainMenu::render() {
 void TextInputMenu::input() {
 	static int previousState = -1;
 	int currentState = -1;
-	static bool playMusic = true;
 
 	SDL_StartTextInput();
 
@@ -209,8 +209,12 @@ void TextInputMenu::update() {
 		}
 	}
 
-	Menu::getInstance()->playerNameText->setText(Menu::tempPlayerNamme);
-	Menu::getInstance()->playerNameText->loadText();
+	// Rasterized only when the typed name changes
+	Text* playerNameText = Menu::getInstance()->playerNameText.get();
+	if (playerNameText->getText() != Menu::tempPlayerNamme) {
+		playerNameText->setText(Menu::tempPlayerNamme);
+		playerNameText->loadText();
+	}
 }
 
 void TextInputMenu::render() {
@@ -218,6 +222,7 @@ void TextInputMenu::render() {
 		Menu::getInstance()->menuBackgroundDimension->x / 2, Menu::getInstance()->menuBackgroundDimension->y };
 
 	SDL_RenderCopy(Game::getInstance()->getRenderer(), Menu::getInstance()->mTextureMenu.get(), &srcRect, nullptr);
+	RenderStats::countDrawCalls(1);
 	Selector::getInstance()->render();
 
 	Menu::getInstance()->playerNameText->render();
@@ -226,7 +231,6 @@ void TextInputMenu::render() {
 void PausedMenu::input() {
 	static int previousState = -1;
 	int currentState = -1;
-	static bool playMusic = true;
 
 	MouseStateFlags* mouseFlags = Menu::getInstance()->mouseStateFlags.get();
 	PauseFlags* pauseFlags = Menu::getInstance()->pauseFlags.get();
@@ -322,6 +326,11 @@ void PausedMenu::update() {
 }
 
 void PausedMenu::render() {
+	renderStatic();
+	renderDynamic();
+}
+
+void PausedMenu::renderStatic() {
 	SDL_Renderer* renderer = Game::getInstance()->getRenderer();
 	SDL_Rect* dstRect = Menu::getInstance()->pausedGameOverDstRect.get();
 
@@ -329,16 +338,18 @@ void PausedMenu::render() {
 		Menu::getInstance()->pauseGODimension->x / 2, Menu::getInstance()->pauseGODimension->y };
 
 	SDL_RenderCopy(renderer, Menu::getInstance()->mTexturePauseGO.get(), &srcRect, dstRect);
-	
-	Selector::getInstance()->render();
+	RenderStats::countDrawCalls(1);
 
 	Border::bRenderBorder(renderer, *dstRect, 3, { 0, 0, 0, 255 } );
 }
 
+void PausedMenu::renderDynamic() {
+	Selector::getInstance()->render();
+}
+
 void GameOverMenu::input() {
 	static int previousState = -1;
 	int currentState = -1;
-	static bool playMusic = true;
 
 	MouseStateFlags* mouseFlags = Menu::getInstance()->mouseStateFlags.get();
 	GameOverFlags* gameOverFlags = Menu::getInstance()->gameOverFlags.get();
@@ -409,6 +420,11 @@ void GameOverMenu::update() {
 }
 
 void GameOverMenu::render() {
+	renderStatic();
+	renderDynamic();
+}
+
+void GameOverMenu::renderStatic() {
 	SDL_Renderer* renderer = Game::getInstance()->getRenderer();
 	SDL_Rect* dstRect = Menu::getInstance()->pausedGameOverDstRect.get();
 
@@ -416,7 +432,11 @@ void GameOverMenu::render() {
 		Menu::getInstance()->pauseGODimension->x / 2, Menu::getInstance()->pauseGODimension->y };
 
 	SDL_RenderCopy(renderer, Menu::getInstance()->mTexturePauseGO.get(), &srcRect, dstRect);
-	Selector::getInstance()->render();
+	RenderStats::countDrawCalls(1);
 
 	Border::bRenderBorder(renderer, *dstRect, 3, { 0, 0, 0, 255 });
+}
+
+void GameOverMenu::renderDynamic() {
+	Selector::getInstance()->render();
 }
\ No newline at end of file
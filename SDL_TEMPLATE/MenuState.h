@@ -4,6 +4,11 @@ public:
 	virtual void input() = 0;
 	virtual void update() = 0;
 	virtual void render() = 0;
+
+	// Split of render for menus drawn over a frozen frame: the static part is cached with it, the dynamic part
+	// is drawn over the cache every frame. Menus that don't split draw everything as dynamic.
+	virtual void renderStatic() {}
+	virtual void renderDynamic() { render(); }
 };
 
 class MainMenu : public MenuState {
@@ -25,6 +30,8 @@ public:
 	void input() override;
 	void update() override;
 	void render() override;
+	void renderStatic() override;
+	void renderDynamic() override;
 };
 
 class GameOverMenu : public MenuState {
@@ -32,4 +39,6 @@ public:
 	void input() override;
 	void update() override;
 	void render() override;
+	void renderStatic() override;
+	void renderDynamic() override;
 };
\ No newline at end of file
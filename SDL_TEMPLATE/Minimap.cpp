@@ -1,14 +1,17 @@
 #include "Minimap.h"
 #include "Game.h"
 #include "AppInfo.h"
-#include "Background.h"
+#include "World.h"
 #include "WaveManager.h"
 #include "InvokerPlaying.h"
 #include "Bullet.h"
 #include "EnemyType.h"
 #include "Enemy.h"
 #include "BorderManager.h"
-#include "FastEnemy.h"
+#include "RenderList.h"
+#include "AllocationTracker.h"
+#include "RenderStats.h"
+#include "RenderTargetScope.h"
 
 Minimap::Minimap() : minimapTexture(nullptr), dstRectMinimap({ 0, 0, 0, 0 }), scaleX(0), scaleY(0) {}
 
@@ -17,12 +20,6 @@ Minimap* Minimap::getInstance() {
 	return &instance;
 }
 
-void Minimap::clearVectors() {
-	players.clear();
-	bullets.clear();
-	enemies.clear();
-}
-
 void Minimap::initMinimapTexture() {
 	constexpr int ALLOWANCE = 15;
 	constexpr int DIMENSION = 150;
@@ -42,8 +39,8 @@ void Minimap::initMinimapTexture() {
 }
 
 void Minimap::initScalars() {
-	scaleX = static_cast<float>(dstRectMinimap.w) / Background::getInstance()->getDimension().x;
-	scaleY = static_cast<float>(dstRectMinimap.h) / Background::getInstance()->getDimension().y;
+	scaleX = static_cast<float>(dstRectMinimap.w) / World::getInstance()->getDimension().x;
+	scaleY = static_cast<float>(dstRectMinimap.h) / World::getInstance()->getDimension().y;
 }
 
 void Minimap::initMinimap() {
@@ -57,11 +54,16 @@ void Minimap::renderBorder(SDL_Renderer*& renderer) {
 	Border::bRenderBorder(renderer, dstRectMinimap, BORDER_THICK, borderColor);
 }
 
-void Minimap::update() {
+// Runs on the simulation thread, only reads the world and the scalars set at init
+void Minimap::capture(MinimapRenderState& minimap) const {
+	AllocationTagScope allocationTag(Allocation_Tag::HUD);
+
 	constexpr static SDL_Point PLAYER_DIMENSION = { 4, 4 };
 	constexpr static SDL_Point BULLET_DIMENSION = { 2, 2 };
 
-	clearVectors();
+	minimap.players.clear();
+	minimap.bullets.clear();
+	minimap.enemies.clear();
 
 	for (const auto& player : InvokerPlaying::getInstance()->players) {
 		SDL_Rect playerPos = {
@@ -70,7 +72,7 @@ void Minimap::update() {
 			PLAYER_DIMENSION.x,
 			PLAYER_DIMENSION.y
 		};
-		players.push_back(playerPos);
+		minimap.players.push_back(playerPos);
 	}
 
 	for (const auto& bullet : Bullet::bullets) {
@@ -80,7 +82,7 @@ void Minimap::update() {
 			BULLET_DIMENSION.x,
 			BULLET_DIMENSION.y
 		};
-		bullets.push_back(bulletPos);
+		minimap.bullets.push_back(bulletPos);
 	}
 
 	for (const auto& enemy : WaveManager::getInstance()->getEnemies()) {
@@ -91,34 +93,38 @@ void Minimap::update() {
 			enemy->getMinimapPixelSize()
 		};
 
-		if (enemyPos.w != 0 && enemyPos.h != 0) enemies.push_back(enemyPos);
+		if (enemyPos.w != 0 && enemyPos.h != 0) minimap.enemies.push_back(enemyPos);
 	}
 }
 
-void Minimap::render() {
+void Minimap::render(const MinimapRenderState& minimap) {
 	SDL_Renderer* renderer = Game::getInstance()->getRenderer();
 
 	SDL_SetTextureBlendMode(minimapTexture, SDL_BLENDMODE_BLEND);
-	SDL_SetRenderTarget(renderer, minimapTexture);
-	SDL_SetRenderDrawColor(renderer, 255, 255, 255, 75);
-	SDL_RenderClear(renderer);
-
-	for (const auto& player : players) {
-		SDL_SetRenderDrawColor(renderer, 0, 0, 0, 170);
-		SDL_RenderFillRect(renderer, &player);
-	}
-
-	for (const auto& bullet : bullets) {
-		SDL_SetRenderDrawColor(renderer, 70, 70, 70, 150);
-		SDL_RenderFillRect(renderer, &bullet);
-	}
-
-	for (const auto& enemy : enemies) {
-		SDL_SetRenderDrawColor(renderer, 150, 50, 50, 120);
-		SDL_RenderFillRect(renderer, &enemy);
+	{
+		RenderTargetScope target(renderer, minimapTexture);
+		SDL_SetRenderDrawColor(renderer, 255, 255, 255, 75);
+		SDL_RenderClear(renderer);
+
+		for (const auto& player : minimap.players) {
+			SDL_SetRenderDrawColor(renderer, 0, 0, 0, 170);
+			SDL_RenderFillRect(renderer, &player);
+		}
+
+		for (const auto& bullet : minimap.bullets) {
+			SDL_SetRenderDrawColor(renderer, 70, 70, 70, 150);
+			SDL_RenderFillRect(renderer, &bullet);
+		}
+
+		for (const auto& enemy : minimap.enemies) {
+			SDL_SetRenderDrawColor(renderer, 150, 50, 50, 120);
+			SDL_RenderFillRect(renderer, &enemy);
+		}
+
+		RenderStats::countDrawCalls(static_cast<Uint32>(minimap.players.size() + minimap.bullets.size() + minimap.enemies.size()));
 	}
 
-	SDL_SetRenderTarget(renderer, nullptr);
 	renderBorder(renderer);
 	SDL_RenderCopy(renderer, minimapTexture, nullptr, &dstRectMinimap);
+	RenderStats::countDrawCalls(1);
 }
\ No newline at end of file
@@ -2,6 +2,8 @@
 #include <vector>
 #include <SDL.h>
 
+struct MinimapRenderState;
+
 class Minimap {
 private:
 	Minimap();
@@ -18,21 +20,17 @@ public:
 private:
 	SDL_Texture* minimapTexture;
 	SDL_Rect dstRectMinimap;
-	std::vector<SDL_Rect> players;
-	std::vector<SDL_Rect> bullets;
-	std::vector<SDL_Rect> enemies;
 	float scaleX;
 	float scaleY;
 
 private:
-	void clearVectors();
 	void initMinimapTexture();
 	void initScalars();
 	void renderBorder(SDL_Renderer*& renderer);
 
 public:
 	void initMinimap();
-	void update();
-	void render();
+	void capture(MinimapRenderState& minimap) const;
+	void render(const MinimapRenderState& minimap);
 };
 
@@ -1,21 +1,23 @@
 #include "Player.h"
 #include "Command.h"
 #include "TextureType.h"
-#include "Game.h"
-#include "Background.h"
-#include "Enemy.h"
+#include "GameHost.h"
+#include "World.h"
+#include "EnemyType.h"
 #include "AppInfo.h"
 #include "GameEnums.h"
-#include "PlayerProfile.h"
-#include "Text.h"
 #include "Bullet.h"
 #include "PrototypeRegistry.h"
 #include "WaveManager.h"
-#include "GameState.h"
-#include "Menu.h"
-#include "MenuState.h"
 #include "CountdownTimer.h"
+#include "Cooldown.h"
 #include "GameSound.h"
+#include "WorldSnapshot.h"
+#include "RenderList.h"
+#include "AllocationTracker.h"
+#include "RenderStats.h"
+#include "Logger.h"
+#include "RenderTargetScope.h"
 #include <string>
 
 int Player::playerCounter = 1;
@@ -37,11 +39,13 @@ Player::Player(int heartAmount, int maxSprintAmount, SDL_Point position, float m
     sprintAmount(std::make_unique<int>(maxSprintAmount)),
     position(std::make_unique<SDL_Point>(position)),
     movementSpeed(std::make_unique<float>(movementSpeed)),
-    speedDecay(std::make_unique<float>(speedDecay)){
+    speedDecay(std::make_unique<float>(speedDecay)),
+    firingTimer(std::make_unique<Cooldown>()),
+    healTimer(std::make_unique<Cooldown>()) {
 
     platformPosition = std::make_unique<SDL_Point>(SDL_Point{
-        position.x + (Player::PLAYER_DIMENSION.x / 2) + Background::getInstance()->srcRect->x,
-        position.y + (Player::PLAYER_DIMENSION.y / 2) + Background::getInstance()->srcRect->y
+        position.x + (Player::PLAYER_DIMENSION.x / 2) + World::getInstance()->srcRect.x,
+        position.y + (Player::PLAYER_DIMENSION.y / 2) + World::getInstance()->srcRect.y
         });
 }
 
@@ -64,15 +68,13 @@ Player::Player(const Player& other)
     directionX(std::make_unique<float>()),
     directionY(std::make_unique<float>()),
     platformPosition(std::make_unique<SDL_Point>(*other.platformPosition)),
-    playerProfile(std::make_unique<PlayerProfile>()),
     alive(std::make_unique<bool>(true)),
     directionFacing(Face_Direction::DOWN),
     deadColorTexture(std::make_unique<SDL_Texture*>()),
-    textPlayerName(std::make_unique<Text>()),
-    textPlayerPosition(std::make_unique<Text>()),
-    stringPlayerName(std::make_unique<std::string>(Player::staticStringPlayerName)),
     dstRectMonitor(std::make_unique<SDL_Rect>()),
     deadTimer(std::make_unique<CountdownTimer>()),
+    firingTimer(std::make_unique<Cooldown>()),
+    healTimer(std::make_unique<Cooldown>()),
     isMovingLeft(std::make_unique<bool>(false)),
     isMovingUpLeft(std::make_unique<bool>(false)),
     isMovingUp(std::make_unique<bool>(false)),
@@ -89,6 +91,9 @@ Player::Player(const Player& other)
     }
 }
 
+// Out of line so the forward-declared members are complete where they are destroyed
+Player::~Player() = default;
+
 void Player::isCommandMove(Command* command) {
     if (dynamic_cast<MoveLeftCommand*>(command) ||
         dynamic_cast<MoveUpCommand*>(command) ||
@@ -111,80 +116,80 @@ void Player::updateMove() {
 
 
     if (*isMovingLeft) {
-        if (Background::getInstance()->isRightEdge()) {
+        if (World::getInstance()->isRightEdge()) {
             position->x -= static_cast<int>(newMovementSpeed);
 
             if (position->x <= (SCREEN_WIDTH / 2)) {
-                Background::getInstance()->srcRect->x -= static_cast<int>(newMovementSpeed);
+                World::getInstance()->srcRect.x -= static_cast<int>(newMovementSpeed);
             }
-        } else if (Background::getInstance()->isLeftEdge()) {
-            Background::getInstance()->srcRect->x = 0;
+        } else if (World::getInstance()->isLeftEdge()) {
+            World::getInstance()->srcRect.x = 0;
             position->x -= static_cast<int>(newMovementSpeed);
 
             if (position->x < BORDER_ALLOWANCE) {
                 position->x = BORDER_ALLOWANCE;
             }
         } else {
-            Background::getInstance()->srcRect->x -= static_cast<int>(newMovementSpeed);
+            World::getInstance()->srcRect.x -= static_cast<int>(newMovementSpeed);
         }
     }
     if (*isMovingUp) {
-        if (Background::getInstance()->isDownEdge()) {
+        if (World::getInstance()->isDownEdge()) {
             position->y -= static_cast<int>(newMovementSpeed);
 
             if (position->y <= (SCREEN_HEIGHT / 2)) {
-                Background::getInstance()->srcRect->y -= static_cast<int>(newMovementSpeed);
+                World::getInstance()->srcRect.y -= static_cast<int>(newMovementSpeed);
             }
-        } else if (Background::getInstance()->isUpEdge()) {
-            Background::getInstance()->srcRect->y = 0;
+        } else if (World::getInstance()->isUpEdge()) {
+            World::getInstance()->srcRect.y = 0;
             position->y -= static_cast<int>(newMovementSpeed);
 
             if (position->y < BORDER_ALLOWANCE) {
                 position->y = BORDER_ALLOWANCE;
             }
         } else {
-            Background::getInstance()->srcRect->y -= static_cast<int>(newMovementSpeed);
+            World::getInstance()->srcRect.y -= static_cast<int>(newMovementSpeed);
         }
     }
     if (*isMovingRight) {
-        if (Background::getInstance()->isLeftEdge()) {
+        if (World::getInstance()->isLeftEdge()) {
             position->x += static_cast<int>(newMovementSpeed);
 
             if (position->x >= (SCREEN_WIDTH / 2)) {
-                Background::getInstance()->srcRect->x += static_cast<int>(newMovementSpeed);
+                World::getInstance()->srcRect.x += static_cast<int>(newMovementSpeed);
             }
-        } else if (Background::getInstance()->isRightEdge()) {
+        } else if (World::getInstance()->isRightEdge()) {
             position->x += static_cast<int>(newMovementSpeed);
 
             if (position->x > SCREEN_WIDTH - BORDER_ALLOWANCE - Player::PLAYER_DIMENSION.x) {
                 position->x = SCREEN_WIDTH - BORDER_ALLOWANCE - Player::PLAYER_DIMENSION.x;
             }
         } else {
-            Background::getInstance()->srcRect->x += static_cast<int>(newMovementSpeed);
+            World::getInstance()->srcRect.x += static_cast<int>(newMovementSpeed);
         }
     }
     if (*isMovingDown) {
-        if (Background::getInstance()->isUpEdge()) {
+        if (World::getInstance()->isUpEdge()) {
             position->y += static_cast<int>(newMovementSpeed);
 
             if (position->y >= (SCREEN_HEIGHT / 2)) {
-                Background::getInstance()->srcRect->y += static_cast<int>(newMovementSpeed);
+                World::getInstance()->srcRect.y += static_cast<int>(newMovementSpeed);
             }
-        } else if (Background::getInstance()->isDownEdge()) {
+        } else if (World::getInstance()->isDownEdge()) {
             position->y += static_cast<int>(newMovementSpeed);
 
             if (position->y > SCREEN_HEIGHT - BORDER_ALLOWANCE - Player::PLAYER_DIMENSION.y) {
                 position->y = SCREEN_HEIGHT - BORDER_ALLOWANCE - Player::PLAYER_DIMENSION.y;
             }
         } else {
-            Background::getInstance()->srcRect->y += static_cast<int>(newMovementSpeed);
+            World::getInstance()->srcRect.y += static_cast<int>(newMovementSpeed);
         }
     }
 }
 
 void Player::updatePlatformPosition() {
-    platformPosition->x = position->x + (Player::PLAYER_DIMENSION.x / 2) + Background::getInstance()->srcRect->x;
-    platformPosition->y = position->y + (Player::PLAYER_DIMENSION.y / 2) + Background::getInstance()->srcRect->y;
+    platformPosition->x = position->x + (Player::PLAYER_DIMENSION.x / 2) + World::getInstance()->srcRect.x;
+    platformPosition->y = position->y + (Player::PLAYER_DIMENSION.y / 2) + World::getInstance()->srcRect.y;
 }
 
 void Player::updateMonitorPosition() {
@@ -202,17 +207,15 @@ void Player::checkHealth() {
     if (*alive && *heartAmount < 1) {
         *alive = false;
     } else if (!(*alive)) {
-        GameSound::getInstance()->playSoundFX(SFX::gameOver);
-
-        setDeadColor();
+        GameHost::getInstance()->runOnMainThread([] { GameSound::getInstance()->playSoundFX(SFX::gameOver); });
 
         if (!deadTimer->hasStarted()) {
             deadTimer->start();
         }
 
         if (deadTimer->isFinished()) {
-            Game::getInstance()->setState(std::make_unique<GameOver>());
-            Menu::getInstance()->setState(std::make_unique<GameOverMenu>());
+            // The main thread reads the menu state while this tick runs
+            GameHost::getInstance()->runOnMainThread([] { GameHost::getInstance()->showGameOver(); });
         }
     }
 }
@@ -226,7 +229,7 @@ void Player::checkCollisionWithEnemies() {
             takeDamage(enemy->getDamage());
             addScore(enemy->getEnemyScore());
             enemy->setDead();
-            GameSound::getInstance()->playSoundFX(SFX::damage);
+            GameHost::getInstance()->runOnMainThread([] { GameSound::getInstance()->playSoundFX(SFX::damage); });
         }
     }
 }
@@ -255,16 +258,8 @@ void Player::updateCommandQueue() {
     }
 }
 
-void Player::updateTextPlayerPosition() {
-    textPlayerPosition->setText(
-        " x:" + std::to_string(platformPosition->x - 34) +
-        "  y:" + std::to_string(platformPosition->y - 34) + " "
-    );
-    textPlayerPosition->loadText();
-}
-
 void Player::setDeadColor() {
-    SDL_Renderer* renderer = Game::getInstance()->getRenderer();
+    SDL_Renderer* renderer = GameHost::getInstance()->getRenderer();
 
     if (deadColorTexture) SDL_DestroyTexture(*deadColorTexture);
 
@@ -273,72 +268,69 @@ void Player::setDeadColor() {
 
     SDL_Texture* tempTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, textureWidth, textureHeight);
     if (!tempTexture) {
-        std::cerr << "Failed to create temp texture: " << SDL_GetError() << std::endl;
+        LOG_ERROR("Failed to create temp texture: %s", SDL_GetError());
         return;
     }
 
-    SDL_SetRenderTarget(renderer, tempTexture);
-    SDL_RenderCopy(renderer, textureType->texture, nullptr, nullptr);
-
     SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, textureWidth, textureHeight, 32, SDL_PIXELFORMAT_RGBA8888);
-    SDL_RenderReadPixels(renderer, nullptr, SDL_PIXELFORMAT_RGBA8888, surface->pixels, surface->pitch);
+    {
+        RenderTargetScope target(renderer, tempTexture);
+        SDL_RenderCopy(renderer, textureType->texture, nullptr, nullptr);
+        SDL_RenderReadPixels(renderer, nullptr, SDL_PIXELFORMAT_RGBA8888, surface->pixels, surface->pitch);
+    }
 
     deadColorTexture = std::make_unique<SDL_Texture*>(SDL_CreateTextureFromSurface(renderer, surface));
     SDL_SetTextureColorMod(*deadColorTexture, 98, 98, 98);
 
     SDL_FreeSurface(surface);
-    SDL_SetRenderTarget(renderer, nullptr);
     SDL_DestroyTexture(tempTexture);
 }
 
-std::unique_ptr<Bullet> Player::getBulletPrototype() {
+std::unique_ptr<Bullet> Player::getBulletPrototype(float bulletDirectionX, float bulletDirectionY) {
     static std::shared_ptr<Bullet> sharedBullet = std::dynamic_pointer_cast<Bullet>(
         PrototypeRegistry::getInstance()->getPrototype(Prototype_Type::BULLET)
     );
-    static std::shared_ptr<TextureType> bulletTexture = std::make_shared<TextureType>(Prototype_Type::BULLET);
-
     std::unique_ptr<Bullet> bullet = std::make_unique<Bullet>(*sharedBullet);
     bullet->initPlayer(shared_from_this());
-    bullet->initDirections(*directionX, *directionY);
+    bullet->initDirections(bulletDirectionX, bulletDirectionY);
     bullet->initMovementSpeed(Player::BULLET_SPEED_SCALAR);
-    bullet->initTexture(bulletTexture);
+    bullet->initTexture(Bullet::sharedTexture);
 
     return bullet;
 }
 
 bool Player::canFire() const {
-    static Uint32 startTime = SDL_GetTicks() + 1100;
-
-    if (SDL_GetTicks() - startTime > *firingCooldown) {
-        startTime = SDL_GetTicks();
-        return true;
-    } else {
-        return false;
-    }
+    return firingTimer->tryTrigger(*firingCooldown);
 }
 
 SDL_Point Player::getBulletPosition() const {
     return {
-            position->x + (Player::PLAYER_DIMENSION.x / 2) + Background::getInstance()->srcRect->x,
-            position->y + (Player::PLAYER_DIMENSION.y / 2) + Background::getInstance()->srcRect->y
+            position->x + (Player::PLAYER_DIMENSION.x / 2) + World::getInstance()->srcRect.x,
+            position->y + (Player::PLAYER_DIMENSION.y / 2) + World::getInstance()->srcRect.y
     };
 }
 
 void Player::firing() {
+    AllocationTagScope allocationTag(Allocation_Tag::BULLETS);
+
     static std::shared_ptr<Bullet> sharedBullet = std::dynamic_pointer_cast<Bullet>(
         PrototypeRegistry::getInstance()->getPrototype(Prototype_Type::BULLET)
     );
 
     if (canFire()) {
-        auto bullet = getBulletPrototype();
+        auto bullet = getBulletPrototype(*directionX, *directionY);
         bullet->initPos(getBulletPosition());
         Bullet::bullets.push_back(std::move(bullet));
-        GameSound::getInstance()->playSoundFX(SFX::fire);
+        GameHost::getInstance()->runOnMainThread([] { GameSound::getInstance()->playSoundFX(SFX::fire); });
     }
 }
 
 void Player::takeDamage(int damage) {
     *heartAmount -= damage;
+
+    if (*heartAmount <= GAME_OVER_PREFETCH_HEARTS) {
+        GameHost::getInstance()->runOnMainThread([] { GameSound::getInstance()->prefetchSoundFX(SFX::gameOver); });
+    }
 }
 
 void Player::addScore(int score) {
@@ -346,7 +338,7 @@ void Player::addScore(int score) {
     staticScore = *this->score;
 }
 
-SDL_Rect Player::getEnemyRect(Enemy& enemy) {
+SDL_Rect Player::getEnemyRect(const EnemyType& enemy) {
     return {
         enemy.getPosition().x,
         enemy.getPosition().y,
@@ -364,14 +356,7 @@ SDL_Rect Player::getPlayerRectPlatform() {
     };
 }
 
-SDL_Rect Player::getDstRectTextPlayerName() {
-    SDL_Rect dstRect = { 0, 15, 110, 35 }; // 105
-    dstRect.x = 105 * *ID + ((dstRect.w + 35) * (*ID - 1));
-
-    return dstRect;
-}
-
-SDL_Rect Player::getSrcRectDirectionFacing() {
+SDL_Rect Player::getSrcRectDirectionFacing() const {
     SDL_Rect srcRect = { 0, 0, textureType->dimension.x, textureType->dimension.y / 8 };
     switch (directionFacing) {
     case Face_Direction::LEFT:      srcRect.y = (textureType->dimension.y / 8) * 2; break;
@@ -388,41 +373,17 @@ SDL_Rect Player::getSrcRectDirectionFacing() {
 }
 
 bool Player::canHeal() const {
-    static Uint32 startTime = SDL_GetTicks() + 1100;
-
-    if (SDL_GetTicks() - startTime > HEALTH_ADDER_COOLDOWN) {
-        startTime = SDL_GetTicks();
-        return true;
-    } else {
-        return false;
-    }
+    return healTimer->tryTrigger(HEALTH_ADDER_COOLDOWN);
 }
 
-void Player::initProfile() {
+void Player::init() {
     Player::textureType = new TextureType(Prototype_Type::PLAYER);
 
-    playerProfile->init(*ID, *heartAmount, *maxSprintAmount);
-
-    textPlayerName->setFont(Font::MOTION_CONTROL_BOLD);
-    textPlayerName->setText(*stringPlayerName);
-    textPlayerName->setDstRect(getDstRectTextPlayerName());
-    textPlayerName->setColor({ 255, 255, 255, 255 });
-    textPlayerName->loadText();
-
-    textPlayerPosition->setFont(Font::MOTION_CONTROL_BOLD);
-    textPlayerPosition->setDstRect({ 1080, 160, 85, 30 });
-    textPlayerPosition->setColor({ 255, 255, 255, 255 });
-
     deadTimer->setDuration(3000);
 }
 
-void Player::updateProfileName() {
-    textPlayerName->setText(staticStringPlayerName);
-    textPlayerName->loadText();
-}
-
+// Runs on the simulation thread, anything that creates textures belongs in render
 void Player::update() {
-    updateProfileName();
     checkSprint();
     checkFiring();
     if (*alive) updateCommandQueue();
@@ -432,21 +393,75 @@ void Player::update() {
     checkCollisionWithEnemies();
     if (canHeal()) heal();
     checkHealth();
-    updateTextPlayerPosition();
-    playerProfile->update(*heartAmount, *sprintAmount);
 }
 
-void Player::render() {
-    SDL_Rect srcRect = getSrcRectDirectionFacing();
-    
-    if (*alive) SDL_RenderCopy(Game::getInstance()->getRenderer(), textureType->texture, &srcRect, dstRectMonitor.get());
-    else SDL_RenderCopy(Game::getInstance()->getRenderer(), *deadColorTexture.get(), &srcRect, dstRectMonitor.get());
+void Player::render(const PlayerRenderState& state) {
+    SDL_Renderer* renderer = GameHost::getInstance()->getRenderer();
+
+    if (state.alive) {
+        SDL_RenderCopy(renderer, textureType->texture, &state.srcRect, &state.dstRect);
+        RenderStats::countDrawCalls(1);
+        return;
+    }
+
+    if (!*deadColorTexture) setDeadColor();
+    SDL_RenderCopy(renderer, *deadColorTexture, &state.srcRect, &state.dstRect);
+    RenderStats::countDrawCalls(1);
 }
 
-void Player::renderPlayerProfiles() const {
-    playerProfile->render();
-    textPlayerName->render();
-    textPlayerPosition->render();
+void Player::saveSnapshot(PlayerSnapshot& snapshot) const {
+    snapshot.ID = *ID;
+    snapshot.heartAmount = *heartAmount;
+    snapshot.sprintAmount = *sprintAmount;
+    snapshot.score = *score;
+    snapshot.firingCooldown = *firingCooldown;
+    snapshot.firingElapsed = firingTimer->getElapsedTime();
+    snapshot.healElapsed = healTimer->getElapsedTime();
+    snapshot.firingTriggered = firingTimer->hasTriggered();
+    snapshot.healTriggered = healTimer->hasTriggered();
+    snapshot.position = *position;
+    snapshot.platformPosition = *platformPosition;
+    snapshot.directionX = *directionX;
+    snapshot.directionY = *directionY;
+    snapshot.directionFacing = directionFacing;
+    snapshot.alive = *alive;
+}
+
+void Player::restoreSnapshot(const PlayerSnapshot& snapshot) {
+    *heartAmount = snapshot.heartAmount;
+    *sprintAmount = snapshot.sprintAmount;
+    *score = snapshot.score;
+    *firingCooldown = snapshot.firingCooldown;
+    firingTimer->restore(snapshot.firingElapsed, snapshot.firingTriggered);
+    healTimer->restore(snapshot.healElapsed, snapshot.healTriggered);
+    *position = snapshot.position;
+    *platformPosition = snapshot.platformPosition;
+    *directionX = snapshot.directionX;
+    *directionY = snapshot.directionY;
+    directionFacing = snapshot.directionFacing;
+    *alive = snapshot.alive;
+
+    if (*alive) deadTimer->setFinish();
+
+    updateMonitorPosition();
+}
+
+void Player::saveRenderState(PlayerRenderState& state) const {
+    state.ID = *ID;
+    state.srcRect = getSrcRectDirectionFacing();
+    state.dstRect = *dstRectMonitor;
+    state.alive = *alive;
+    state.heartAmount = *heartAmount;
+    state.sprintAmount = *sprintAmount;
+    state.platformPosition = *platformPosition;
+}
+
+void Player::restoreBullet(const BulletSnapshot& snapshot) {
+    AllocationTagScope allocationTag(Allocation_Tag::BULLETS);
+
+    auto bullet = getBulletPrototype(snapshot.directionX, snapshot.directionY);
+    bullet->initPos(snapshot.position);
+    Bullet::bullets.push_back(std::move(bullet));
 }
 
 int Player::getID() const {
@@ -9,17 +9,20 @@ using Vector = SDL_Point;
 
 class Command;
 class TextureType;
-class PlayerProfile;
-class Text;
-class Enemy;
+class EnemyType;
 class Bullet;
 class CountdownTimer;
+class Cooldown;
+struct PlayerSnapshot;
+struct BulletSnapshot;
+struct PlayerRenderState;
 
 class Player : 
 	public Prototype, public std::enable_shared_from_this<Player> {
 private:
 	constexpr static int HEALTH_ADDER_COOLDOWN = 700;
 	constexpr static int HEALTH_ADDER = 1;
+	constexpr static int GAME_OVER_PREFETCH_HEARTS = 2; // Start decoding the game over sound once this low
 public:
 	constexpr static Dimension PLAYER_DIMENSION = { 45, 45 };
 	constexpr static int SPEED_AMOUNT = 3;
@@ -51,15 +54,13 @@ public:
 	std::unique_ptr<float> directionX;
 	std::unique_ptr<float> directionY;
 	std::unique_ptr<SDL_Point> platformPosition;
-	std::unique_ptr<PlayerProfile> playerProfile;
 	std::unique_ptr<bool> alive;
 	Face_Direction directionFacing;
 	std::unique_ptr<SDL_Texture*> deadColorTexture;
-	std::unique_ptr<Text> textPlayerName;
-	std::unique_ptr<Text> textPlayerPosition;
-	std::unique_ptr<std::string> stringPlayerName;
 	std::unique_ptr<SDL_Rect> dstRectMonitor;
 	std::unique_ptr<CountdownTimer> deadTimer;
+	std::unique_ptr<Cooldown> firingTimer; // Per player, so one player's shots don't hold back the others
+	std::unique_ptr<Cooldown> healTimer;
 	
 	std::unique_ptr<bool> isMovingLeft;
 	std::unique_ptr<bool> isMovingUpLeft;
@@ -75,13 +76,12 @@ private:
 	void setDeadColor();
 	void firing();
 	void takeDamage(int damage);
-	std::unique_ptr<Bullet> getBulletPrototype();
+	std::unique_ptr<Bullet> getBulletPrototype(float bulletDirectionX, float bulletDirectionY);
 	bool canFire() const;
 	SDL_Point getBulletPosition() const;
-	SDL_Rect getEnemyRect(Enemy& enemy);
+	SDL_Rect getEnemyRect(const EnemyType& enemy);
 	SDL_Rect getPlayerRectPlatform();
-	SDL_Rect getDstRectTextPlayerName();
-	SDL_Rect getSrcRectDirectionFacing();
+	SDL_Rect getSrcRectDirectionFacing() const;
 	void heal();
 
 	void checkSprint();
@@ -93,7 +93,6 @@ private:
 	void checkCollisionWithEnemies();
 	bool canHeal() const;
 	void checkHealth();
-	void updateTextPlayerPosition();
 
 
 public:
@@ -102,14 +101,17 @@ public:
 public:
 	Player(int heartCount, int sprintAmount, SDL_Point position, float movementSpeed, float speedDecay);
 	Player(const Player& other);
-	~Player() = default;
+	~Player();
 
-	void initProfile();
-	void updateProfileName();
+	void init();
 	void addScore(int score);
 	void update();
-	void render();
-	void renderPlayerProfiles() const;
+	void render(const PlayerRenderState& state);
+
+	void saveSnapshot(PlayerSnapshot& snapshot) const;
+	void restoreSnapshot(const PlayerSnapshot& snapshot);
+	void restoreBullet(const BulletSnapshot& snapshot);
+	void saveRenderState(PlayerRenderState& state) const;
 
 	int getID() const;
 	std::shared_ptr<Prototype> clone() const override;
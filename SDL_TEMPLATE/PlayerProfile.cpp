@@ -1,9 +1,16 @@
 #include "PlayerProfile.h"
 #include "Bar.h"
+#include "Text.h"
+#include "Player.h"
+#include "RenderList.h"
+#include "AllocationTracker.h"
 #include "Game.h"
 #include "SDL_image.h"
 #include "BorderManager.h"
-#include <iostream>
+#include "RenderStats.h"
+#include "Logger.h"
+#include "RenderTargetScope.h"
+#include <climits>
 
 constexpr const static char* PATH = "assets/images/players_profile.png";
 
@@ -18,10 +25,10 @@ void PlayerProfile::loadPlayerProfiles() {
 			surface
 			);
 
-		if (mTextureProfiles) std::cout << "Text with path " << PATH << " loaded." << '\n';
-		else std::cout << "Failed to create texture from surface of player profiles" << SDL_GetError() << '\n';
+		if (mTextureProfiles) LOG_DEBUG("Text with path %s loaded.", PATH);
+		else LOG_ERROR("Failed to create texture from surface of player profiles: %s", SDL_GetError());
 	} else {
-		std::cout << "Failed to load player profiles: " << IMG_GetError() << '\n';
+		LOG_ERROR("Failed to load player profiles: %s", IMG_GetError());
 	}
 
 	SDL_FreeSurface(surface);
@@ -32,7 +39,10 @@ PlayerProfile::PlayerProfile() :
 	mTexture(nullptr), 
 	healthBar(nullptr),
 	sprintBar(nullptr),
-	alive(true) {}
+	alive(true),
+	textPlayerName(std::make_unique<Text>()),
+	textPlayerPosition(std::make_unique<Text>()),
+	shownPlatformPosition({ INT_MIN, INT_MIN }) {}
 
 PlayerProfile::~PlayerProfile() {
 	SDL_DestroyTexture(mTexture);
@@ -133,6 +143,25 @@ void PlayerProfile::initSprintBar(int maxSprint) {
 	sprintBar->setProgressBarColor(SPRINT_COLOR);
 }
 
+void PlayerProfile::initTextPlayerName() {
+	SDL_Rect dstRect = { 0, 15, 110, 35 }; // 105
+	dstRect.x = 105 * playerID + ((dstRect.w + 35) * (playerID - 1));
+
+	shownPlayerName = Player::staticStringPlayerName;
+
+	textPlayerName->setFont(Font::MOTION_CONTROL_BOLD);
+	textPlayerName->setText(shownPlayerName);
+	textPlayerName->setDstRect(dstRect);
+	textPlayerName->setColor({ 255, 255, 255, 255 });
+	textPlayerName->loadText();
+}
+
+void PlayerProfile::initTextPlayerPosition() {
+	textPlayerPosition->setFont(Font::MOTION_CONTROL_BOLD);
+	textPlayerPosition->setDstRect({ 1080, 160, 85, 30 });
+	textPlayerPosition->setColor({ 255, 255, 255, 255 });
+}
+
 void PlayerProfile::checkHealth(const int& healthAmount) {
 	if (healthAmount < 1) {
 		alive = false;
@@ -151,6 +180,8 @@ void PlayerProfile::init(int playerID, int maxHealth, int maxSprint) {
 	initMDstRectSprintBar();
 	initHealthBar(maxHealth);
 	initSprintBar(maxSprint);
+	initTextPlayerName();
+	initTextPlayerPosition();
 }
 
 void PlayerProfile::update(int healthAmount, int sprintAmount) {
@@ -159,20 +190,57 @@ void PlayerProfile::update(int healthAmount, int sprintAmount) {
 	checkHealth(healthAmount);
 }
 
-void PlayerProfile::render() const {
+void PlayerProfile::updateTextPlayerName() {
+	shownPlayerName = Player::staticStringPlayerName;
+
+	textPlayerName->setText(shownPlayerName);
+	textPlayerName->loadText();
+}
+
+void PlayerProfile::updateTextPlayerPosition(const SDL_Point& shownPosition) {
+	shownPlatformPosition = shownPosition;
+
+	char text[POSITION_TEXT_CAPACITY];
+	SDL_snprintf(text, sizeof(text), " x:%d  y:%d ", shownPosition.x - 34, shownPosition.y - 34);
+	textPlayerPosition->setText(text);
+	textPlayerPosition->loadText();
+}
+
+// Texts are only re-rasterized when the value they show changes
+void PlayerProfile::render(const PlayerRenderState& state) {
+	AllocationTagScope allocationTag(Allocation_Tag::HUD);
+
+	if (shownPlayerName != Player::staticStringPlayerName) updateTextPlayerName();
+
+	if (shownPlatformPosition.x != state.platformPosition.x || shownPlatformPosition.y != state.platformPosition.y) {
+		updateTextPlayerPosition(state.platformPosition);
+	}
+
+	update(state.heartAmount, state.sprintAmount);
+
+	renderPanel();
+	textPlayerName->render();
+	textPlayerPosition->render();
+}
+
+void PlayerProfile::renderPanel() const {
 	SDL_Renderer* renderer = Game::getInstance()->getRenderer();
 
 	SDL_SetTextureBlendMode(mTexture, SDL_BLENDMODE_BLEND);
-	SDL_SetRenderTarget(renderer, mTexture);
-	SDL_SetRenderDrawColor(renderer, 255, 255, 255, 120);
-	SDL_RenderClear(renderer);
-
-	SDL_RenderCopy(renderer, mTextureProfiles, &mSrcRectProfile, &mDstRectProfile);
-	SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-	SDL_RenderDrawLine(renderer, mDstRectProfile.w, 0, mDstRectProfile.w - 1, mDstRectProfile.h);
+	{
+		RenderTargetScope target(renderer, mTexture);
+		SDL_SetRenderDrawColor(renderer, 255, 255, 255, 120);
+		SDL_RenderClear(renderer);
+
+		SDL_RenderCopy(renderer, mTextureProfiles, &mSrcRectProfile, &mDstRectProfile);
+		RenderStats::countDrawCalls(1);
+		SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+		SDL_RenderDrawLine(renderer, mDstRectProfile.w, 0, mDstRectProfile.w - 1, mDstRectProfile.h);
+		RenderStats::countDrawCalls(1);
+	}
 
-	SDL_SetRenderTarget(renderer, nullptr);
 	SDL_RenderCopy(renderer, mTexture, nullptr, &mDstRectTexture);
+	RenderStats::countDrawCalls(1);
 
 	healthBar->render();
 	sprintBar->render();
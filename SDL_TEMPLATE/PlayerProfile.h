@@ -1,7 +1,13 @@
 #pragma once
 #include <SDL.h>
+#include <memory>
+#include <string>
 
 class Bar;
+class Text;
+struct PlayerRenderState;
+
+// One player's HUD panel: portrait, health and sprint bars, name and world position
 
 class PlayerProfile {
 private:
@@ -10,6 +16,7 @@ private:
 	constexpr static int Y_ALLOWANCE = 15;
 	constexpr static SDL_Point TEXTURE_DIMENSION = { 235, 80 };
 	constexpr static int X_ALLOWANCE = 15;
+	constexpr static int POSITION_TEXT_CAPACITY = 32;
 	SDL_Color SPRINT_COLOR;
 	static SDL_Texture* mTextureProfiles;
 
@@ -24,6 +31,10 @@ private:
 	Bar* healthBar;
 	Bar* sprintBar;
 	bool alive;
+	std::unique_ptr<Text> textPlayerName;
+	std::unique_ptr<Text> textPlayerPosition;
+	std::string shownPlayerName; // Last values baked into the texts
+	SDL_Point shownPlatformPosition;
 
 private:
 	void initPlayerID(int playerID);
@@ -36,8 +47,14 @@ private:
 	void initMDstRectSprintBar();
 	void initHealthBar(int maxHealth);
 	void initSprintBar(int maxSprint);
+	void initTextPlayerName();
+	void initTextPlayerPosition();
 
 	void checkHealth(const int& healthAmount);
+	void update(int healthAmount, int sprintAmount);
+	void updateTextPlayerName();
+	void updateTextPlayerPosition(const SDL_Point& shownPosition);
+	void renderPanel() const;
 
 public:
 	static void loadPlayerProfiles();
@@ -47,7 +64,6 @@ public:
 	~PlayerProfile();
 
 	void init(int playerID, int maxHealth, int maxSprint);
-	void update(int healthAmount, int sprintAmount);
-	void render() const;
+	void render(const PlayerRenderState& state);
 };
 
@@ -17,4 +17,9 @@ std::shared_ptr<Prototype> PrototypeRegistry::getPrototype(Prototype_Type type)
         return prototypes.at(type)->clone();
     }
     return nullptr;
+}
+
+const Prototype* PrototypeRegistry::findPrototype(Prototype_Type type) const {
+    auto it = prototypes.find(type);
+    return it != prototypes.end() ? it->second.get() : nullptr;
 }
\ No newline at end of file
@@ -25,5 +25,8 @@ public:
 	void addPrototype(Prototype_Type type, std::shared_ptr<Prototype> prototype);
 
 	std::shared_ptr<Prototype> getPrototype(Prototype_Type type) const;
+
+	// The registered original, for reading without cloning. Null when the type is not registered
+	const Prototype* findPrototype(Prototype_Type type) const;
 };
 
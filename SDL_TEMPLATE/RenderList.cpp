@@ -0,0 +1,68 @@
+#include "RenderList.h"
+#include "Game.h"
+#include "World.h"
+#include "InvokerPlaying.h"
+#include "Player.h"
+#include "Bullet.h"
+#include "EnemyType.h"
+#include "WaveManager.h"
+#include "Minimap.h"
+#include "RenderStats.h"
+
+void RenderList::capture() {
+	players.clear();
+	bullets.clear();
+	enemies.clear();
+
+	backgroundSrcRect = World::getInstance()->srcRect;
+
+	for (const auto& player : InvokerPlaying::getInstance()->players) {
+		PlayerRenderState playerState;
+		playerState.player = player.second;
+		player.second->saveRenderState(playerState);
+		players.push_back(std::move(playerState));
+	}
+
+	for (const auto& bullet : Bullet::bullets) {
+		SpriteCommand sprite;
+		bullet->saveRenderState(sprite);
+		bullets.push_back(sprite);
+	}
+
+	for (const auto& enemy : WaveManager::getInstance()->getEnemies()) {
+		SpriteCommand sprite;
+		enemy->saveRenderState(sprite);
+		enemies.push_back(sprite);
+	}
+
+	WaveManager::getInstance()->saveHudState(hud);
+	Minimap::getInstance()->capture(minimap);
+}
+
+void RenderList::renderSprites(const std::vector<SpriteCommand>& sprites) const {
+	SDL_Renderer* renderer = Game::getInstance()->getRenderer();
+
+	for (const auto& sprite : sprites) {
+		SDL_RenderCopyEx(renderer, sprite.texture, nullptr, &sprite.dstRect, sprite.angle, nullptr, SDL_FLIP_NONE);
+	}
+	RenderStats::countDrawCalls(static_cast<Uint32>(sprites.size()));
+}
+
+RenderBuffers::RenderBuffers() : lists(), frontIndex(0) {}
+
+RenderList& RenderBuffers::getBack() {
+	return lists[1 - frontIndex];
+}
+
+const RenderList& RenderBuffers::getFront() const {
+	return lists[frontIndex];
+}
+
+void RenderBuffers::swap() {
+	frontIndex = 1 - frontIndex;
+}
+
+// Used when the world changes outside a simulation tick, so the next frame doesn't show stale state
+void RenderBuffers::captureFront() {
+	lists[frontIndex].capture();
+}
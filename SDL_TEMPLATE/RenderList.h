@@ -0,0 +1,66 @@
+#pragma once
+#include <SDL.h>
+#include <memory>
+#include <vector>
+
+class Player;
+
+// A textured quad in screen space
+struct SpriteCommand {
+	SDL_Texture* texture;
+	SDL_Rect dstRect;
+	double angle;
+};
+
+struct PlayerRenderState {
+	std::shared_ptr<Player> player; // Kept alive for drawing even if the tick removes it from the invoker
+	int ID;
+	SDL_Rect srcRect;
+	SDL_Rect dstRect;
+	bool alive;
+	int heartAmount;
+	int sprintAmount;
+	SDL_Point platformPosition;
+};
+
+struct HudRenderState {
+	int waveCount;
+	int score;
+	bool countdownVisible;
+	Uint32 countdownDuration; // The countdown bar's max amount, only the main thread touches the bar
+	float countdownRemaining;
+};
+
+struct MinimapRenderState {
+	std::vector<SDL_Rect> players;
+	std::vector<SDL_Rect> bullets;
+	std::vector<SDL_Rect> enemies;
+};
+
+// Everything the main thread needs to draw one gameplay frame, captured at the end of a simulation tick
+struct RenderList {
+	SDL_Rect backgroundSrcRect;
+	std::vector<PlayerRenderState> players;
+	std::vector<SpriteCommand> bullets;
+	std::vector<SpriteCommand> enemies;
+	HudRenderState hud;
+	MinimapRenderState minimap;
+
+	void capture();
+	void renderSprites(const std::vector<SpriteCommand>& sprites) const;
+};
+
+// The simulation fills the back list while the main thread draws the front one
+class RenderBuffers {
+private:
+	RenderList lists[2];
+	int frontIndex;
+
+public:
+	RenderBuffers();
+
+	RenderList& getBack();
+	const RenderList& getFront() const;
+	void swap();
+	void captureFront();
+};
@@ -0,0 +1,20 @@
+#include "RenderStats.h"
+
+std::atomic<Uint32> RenderStats::drawCalls(0);
+std::atomic<Uint32> RenderStats::textRasterizations(0);
+
+void RenderStats::countDrawCalls(Uint32 count) {
+	drawCalls.fetch_add(count, std::memory_order_relaxed);
+}
+
+void RenderStats::countTextRasterization() {
+	textRasterizations.fetch_add(1, std::memory_order_relaxed);
+}
+
+Uint32 RenderStats::takeDrawCalls() {
+	return drawCalls.exchange(0, std::memory_order_relaxed);
+}
+
+Uint32 RenderStats::takeTextRasterizations() {
+	return textRasterizations.exchange(0, std::memory_order_relaxed);
+}
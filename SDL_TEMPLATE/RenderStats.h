@@ -0,0 +1,18 @@
+#pragma once
+#include <SDL.h>
+#include <atomic>
+
+// Draw calls and text rasterizations, counted from anywhere and taken once per frame by Telemetry
+class RenderStats {
+private:
+	static std::atomic<Uint32> drawCalls;
+	static std::atomic<Uint32> textRasterizations;
+
+public:
+	static void countDrawCalls(Uint32 count);
+	static void countTextRasterization();
+
+	// Return the count since the last take and start over
+	static Uint32 takeDrawCalls();
+	static Uint32 takeTextRasterizations();
+};
@@ -0,0 +1,23 @@
+#pragma once
+#include <SDL.h>
+
+// Binds an offscreen target and puts back whatever was bound before, instead of the window.
+// Offscreen passes can then run inside another one, e.g. the HUD bars while pause captures the whole scene.
+class RenderTargetScope {
+private:
+	SDL_Renderer* renderer;
+	SDL_Texture* previousTarget;
+
+public:
+	RenderTargetScope(SDL_Renderer* renderer, SDL_Texture* target)
+		: renderer(renderer), previousTarget(SDL_GetRenderTarget(renderer)) {
+		SDL_SetRenderTarget(renderer, target);
+	}
+
+	~RenderTargetScope() {
+		SDL_SetRenderTarget(renderer, previousTarget);
+	}
+
+	RenderTargetScope(const RenderTargetScope&) = delete;
+	RenderTargetScope& operator=(const RenderTargetScope&) = delete;
+};
@@ -0,0 +1,189 @@
+#include "RewindManager.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+	constexpr size_t MIN_ZERO_RUN = 4;
+	constexpr size_t MAX_RUN = 0xFFFF;
+
+	Uint8 xorByte(const std::vector<Uint8>& base, const std::vector<Uint8>& target, size_t index) {
+		Uint8 baseByte = index < base.size() ? base[index] : 0;
+		return target[index] ^ baseByte;
+	}
+
+	bool isZeroRun(const std::vector<Uint8>& base, const std::vector<Uint8>& target, size_t index) {
+		if (index + MIN_ZERO_RUN > target.size()) return false;
+
+		for (size_t offset = 0; offset < MIN_ZERO_RUN; offset++) {
+			if (xorByte(base, target, index + offset) != 0) return false;
+		}
+		return true;
+	}
+
+	void writeUint16(std::vector<Uint8>& bytes, Uint16 value) {
+		bytes.push_back(static_cast<Uint8>(value & 0xFF));
+		bytes.push_back(static_cast<Uint8>(value >> 8));
+	}
+
+	Uint16 readUint16(const std::vector<Uint8>& bytes, size_t offset) {
+		return static_cast<Uint16>(bytes[offset] | (bytes[offset + 1] << 8));
+	}
+}
+
+RewindManager::RewindManager() : ring(RING_CAPACITY), oldestIndex(0), entryCount(0), tickCounter(0),
+	lastCaptureCounter(0) {}
+
+RewindManager* RewindManager::getInstance() {
+	static RewindManager instance;
+	return &instance;
+}
+
+// Delta layout: [Uint32 target size] then repeated [Uint16 unchanged bytes][Uint16 literal count][XOR literals]
+void RewindManager::encodeDelta(const std::vector<Uint8>& base, const std::vector<Uint8>& target, std::vector<Uint8>& delta) {
+	delta.clear();
+
+	Uint32 targetSize = static_cast<Uint32>(target.size());
+	delta.resize(sizeof(targetSize));
+	std::memcpy(delta.data(), &targetSize, sizeof(targetSize));
+
+	size_t index = 0;
+	while (index < target.size()) {
+		size_t skip = 0;
+		while (index < target.size() && skip < MAX_RUN && xorByte(base, target, index) == 0) {
+			++skip;
+			++index;
+		}
+
+		size_t literalStart = index;
+		size_t literalCount = 0;
+		while (index < target.size() && literalCount < MAX_RUN && !isZeroRun(base, target, index)) {
+			++literalCount;
+			++index;
+		}
+
+		writeUint16(delta, static_cast<Uint16>(skip));
+		writeUint16(delta, static_cast<Uint16>(literalCount));
+
+		for (size_t literal = literalStart; literal < literalStart + literalCount; literal++) {
+			delta.push_back(xorByte(base, target, literal));
+		}
+	}
+}
+
+bool RewindManager::decodeDelta(const std::vector<Uint8>& base, const std::vector<Uint8>& delta, std::vector<Uint8>& target) {
+	Uint32 targetSize = 0;
+	if (delta.size() < sizeof(targetSize)) return false;
+	std::memcpy(&targetSize, delta.data(), sizeof(targetSize));
+
+	target.assign(targetSize, 0);
+	std::copy(base.begin(), base.begin() + std::min<size_t>(base.size(), targetSize), target.begin());
+
+	size_t offset = sizeof(targetSize);
+	size_t index = 0;
+	while (offset + 4 <= delta.size()) {
+		index += readUint16(delta, offset);
+		size_t literalCount = readUint16(delta, offset + 2);
+		offset += 4;
+
+		if (index + literalCount > target.size() || offset + literalCount > delta.size()) return false;
+
+		for (size_t literal = 0; literal < literalCount; literal++) {
+			target[index++] ^= delta[offset++];
+		}
+	}
+
+	return true;
+}
+
+void RewindManager::evictOldest() {
+	int nextIndex = (oldestIndex + 1) % RING_CAPACITY;
+
+	// Promote the successor to a keyframe so the ring can always be decoded from its oldest entry
+	if (entryCount > 1 && !ring[nextIndex].keyframe) {
+		// Every newer entry builds on the one that failed, so none of the history is usable
+		if (!decodeDelta(ring[oldestIndex].data, ring[nextIndex].data, decodeScratch)) {
+			LOG_ERROR("Rewind history is corrupt, dropping all %d snapshots.", entryCount);
+			oldestIndex = 0;
+			entryCount = 0;
+			return;
+		}
+
+		ring[nextIndex].data.swap(decodeScratch);
+		ring[nextIndex].keyframe = true;
+	}
+
+	oldestIndex = nextIndex;
+	--entryCount;
+}
+
+void RewindManager::capture() {
+	Uint64 startCounter = SDL_GetPerformanceCounter();
+
+	scratchSnapshot.capture();
+	scratchSnapshot.serialize(currentRaw);
+
+	if (entryCount == RING_CAPACITY) evictOldest();
+
+	Entry& entry = ring[(oldestIndex + entryCount) % RING_CAPACITY];
+	if (entryCount == 0) {
+		entry.data = currentRaw;
+		entry.keyframe = true;
+	} else {
+		encodeDelta(previousRaw, currentRaw, entry.data);
+		entry.keyframe = false;
+	}
+
+	++entryCount;
+	previousRaw.swap(currentRaw);
+
+	lastCaptureCounter = SDL_GetPerformanceCounter() - startCounter;
+}
+
+void RewindManager::reset() {
+	oldestIndex = 0;
+	entryCount = 0;
+	tickCounter = 0;
+	previousRaw.clear();
+}
+
+void RewindManager::tick() {
+	if (++tickCounter < SNAPSHOT_INTERVAL_TICKS) return;
+
+	tickCounter = 0;
+	capture();
+}
+
+bool RewindManager::rewind() {
+	if (entryCount == 0) return false;
+
+	WorldSnapshot snapshot;
+	if (!snapshot.deserialize(ring[oldestIndex].data)) {
+		LOG_ERROR("Failed to decode rewind snapshot.");
+		reset();
+		return false;
+	}
+
+	float secondsRewound = static_cast<float>(entryCount * SNAPSHOT_INTERVAL_TICKS) / 60.0F;
+	LOG_INFO("Rewound %.2fs (%u bytes buffered, last capture took %.0fus).", secondsRewound,
+		static_cast<unsigned>(getStoredBytes()), getLastCaptureMicroseconds());
+
+	snapshot.apply();
+	reset();
+
+	return true;
+}
+
+double RewindManager::getLastCaptureMicroseconds() const {
+	return static_cast<double>(lastCaptureCounter) * 1000000.0 / static_cast<double>(SDL_GetPerformanceFrequency());
+}
+
+size_t RewindManager::getStoredBytes() const {
+	size_t bytes = 0;
+
+	for (int entry = 0; entry < entryCount; entry++) {
+		bytes += ring[(oldestIndex + entry) % RING_CAPACITY].data.size();
+	}
+
+	return bytes;
+}
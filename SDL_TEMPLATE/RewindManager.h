@@ -0,0 +1,54 @@
+#pragma once
+#include <SDL.h>
+#include <vector>
+#include "WorldSnapshot.h"
+
+class RewindManager {
+private:
+	RewindManager();
+
+public:
+	RewindManager(const RewindManager&) = delete;
+	RewindManager& operator=(const RewindManager&) = delete;
+	RewindManager(RewindManager&&) = delete;
+	RewindManager& operator=(RewindManager&&) = delete;
+
+	static RewindManager* getInstance();
+
+private:
+	constexpr static int SNAPSHOT_INTERVAL_TICKS = 6; // 10 snapshots per second at 60 FPS
+	constexpr static int RING_CAPACITY = 50; // ~5 seconds of history
+
+	// The oldest entry is always a keyframe, every newer entry is a delta against the one before it
+	struct Entry {
+		std::vector<Uint8> data;
+		bool keyframe;
+	};
+
+	std::vector<Entry> ring;
+	int oldestIndex;
+	int entryCount;
+	int tickCounter;
+
+	WorldSnapshot scratchSnapshot;
+	std::vector<Uint8> previousRaw;
+	std::vector<Uint8> currentRaw;
+	std::vector<Uint8> decodeScratch;
+
+	Uint64 lastCaptureCounter;
+
+private:
+	static void encodeDelta(const std::vector<Uint8>& base, const std::vector<Uint8>& target, std::vector<Uint8>& delta);
+	static bool decodeDelta(const std::vector<Uint8>& base, const std::vector<Uint8>& delta, std::vector<Uint8>& target);
+
+	void capture();
+	void evictOldest();
+
+public:
+	void reset();
+	void tick();
+	bool rewind();
+
+	double getLastCaptureMicroseconds() const;
+	size_t getStoredBytes() const;
+};
@@ -1,7 +1,8 @@
 #include "Selector.h"
 #include "Game.h"
 #include "AppInfo.h"
-#include <iostream>
+#include "RenderStats.h"
+#include "Logger.h"
 #include <SDL_image.h>
 
 Selector::Selector() {}
@@ -15,11 +16,11 @@ void Selector::init() {
 	SDL_Texture* rawTexture = IMG_LoadTexture(Game::getInstance()->getRenderer(), PATH);
 
 	if (!rawTexture) {
-		std::cerr << "Failed to create texture from file " << PATH << ": " << SDL_GetError() << '\n';
+		LOG_ERROR("Failed to create texture from file %s: %s", PATH, SDL_GetError());
 		return;
 	}
 
-	std::cout << "Texture loaded from path: " << PATH << '\n';
+	LOG_DEBUG("Texture loaded from path: %s", PATH);
 	mTexture.reset(rawTexture);
 
 	SDL_QueryTexture(mTexture.get(), nullptr, nullptr, &dimension.x, &dimension.y);
@@ -49,4 +50,5 @@ void Selector::render() {
 
 	SDL_RenderCopy(renderer, mTexture.get(), nullptr, &leftSelector);
 	SDL_RenderCopyEx(renderer, mTexture.get(), nullptr, &rightSelector, 0.0, nullptr, SDL_FLIP_HORIZONTAL);
+	RenderStats::countDrawCalls(2);
 }
\ No newline at end of file
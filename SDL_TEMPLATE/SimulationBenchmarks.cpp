@@ -0,0 +1,197 @@
+#include "SimulationBenchmarks.h"
+#include "Benchmark.h"
+#include "BenchmarkScenario.h"
+#include "WorldSnapshot.h"
+#include "Game.h"
+#include "World.h"
+#include "Bullet.h"
+#include "Minimap.h"
+#include "PrototypeRegistry.h"
+#include "RenderList.h"
+#include "Text.h"
+#include "WaveManager.h"
+#include "JobSystem.h"
+#include "FrameArena.h"
+#include "GameRandom.h"
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+
+namespace {
+	struct NamedPrototype {
+		Prototype_Type type;
+		const char* name;
+	};
+
+	constexpr int NAMED_PROTOTYPE_COUNT = 8;
+	constexpr NamedPrototype NAMED_PROTOTYPES[NAMED_PROTOTYPE_COUNT] = {
+		{ Prototype_Type::PLAYER, "PLAYER" },
+		{ Prototype_Type::BULLET, "BULLET" },
+		{ Prototype_Type::NORMAL_ENEMY, "NORMAL_ENEMY" },
+		{ Prototype_Type::NORMAL_ENEMY_FAST, "NORMAL_ENEMY_FAST" },
+		{ Prototype_Type::MEDIUM_ENEMY, "MEDIUM_ENEMY" },
+		{ Prototype_Type::MEDIUM_ENEMY_FAST, "MEDIUM_ENEMY_FAST" },
+		{ Prototype_Type::LARGE_ENEMY, "LARGE_ENEMY" },
+		{ Prototype_Type::LARGE_ENEMY_FAST, "LARGE_ENEMY_FAST" }
+	};
+}
+
+// BenchmarkScenario's crowd, plus bullets flying in random directions over the whole world
+void SimulationBenchmarks::buildScenario(WorldSnapshot& scenario, int enemyCount, int bulletCount) {
+	std::mt19937 rng(SCENARIO_SEED);
+	BenchmarkScenario::build(scenario, static_cast<size_t>(enemyCount), rng);
+	GameRandom::seed(SCENARIO_SEED);
+
+	const SDL_Point& worldDimension = World::getInstance()->getDimension();
+
+	std::uniform_int_distribution<int> bulletX(BORDER_ALLOWANCE * 2, worldDimension.x - BORDER_ALLOWANCE * 2 - Bullet::BULLET_DIMENSION.x);
+	std::uniform_int_distribution<int> bulletY(BORDER_ALLOWANCE * 2, worldDimension.y - BORDER_ALLOWANCE * 2 - Bullet::BULLET_DIMENSION.y);
+	std::uniform_real_distribution<float> angleDistribution(0.0F, 6.2831853F);
+
+	for (int bulletIndex = 0; bulletIndex < bulletCount; bulletIndex++) {
+		const float angle = angleDistribution(rng);
+
+		BulletSnapshot bullet;
+		bullet.playerID = scenario.players.front().ID;
+		bullet.position = { bulletX(rng), bulletY(rng) };
+		bullet.directionX = std::cos(angle);
+		bullet.directionY = std::sin(angle);
+		scenario.bullets.push_back(bullet);
+	}
+}
+
+// Untimed per-tick housekeeping, the same the main loop and the simulation thread do between ticks
+void SimulationBenchmarks::restoreIfDue(BenchmarkState& state, const WorldSnapshot& scenario) {
+	state.pauseTiming();
+
+	FrameArena::getThreadArena().reset();
+	if (state.getIteration() % RESTORE_INTERVAL_TICKS == 0) scenario.apply();
+
+	state.resumeTiming();
+}
+
+void SimulationBenchmarks::initWave(BenchmarkState& state) {
+	WaveManager* waveManager = WaveManager::getInstance();
+	const int wave = state.getArgument(0);
+	size_t spawnedEnemies = 0;
+
+	GameRandom::seed(SCENARIO_SEED);
+
+	while (state.keepRunning()) {
+		state.pauseTiming();
+		waveManager->setWaveCount(wave);
+		waveManager->resetGame();
+		state.resumeTiming();
+
+		waveManager->initWave();
+		waveManager->flushSpawns();
+		spawnedEnemies += waveManager->getEnemies().size();
+	}
+
+	state.setCounter("enemies", static_cast<double>(spawnedEnemies) / state.getIterations());
+}
+
+void SimulationBenchmarks::updateEnemies(BenchmarkState& state) {
+	WorldSnapshot scenario;
+	buildScenario(scenario, state.getArgument(0), 0);
+
+	while (state.keepRunning()) {
+		restoreIfDue(state, scenario);
+		WaveManager::getInstance()->update();
+	}
+
+	state.setCounter("workers", Game::getInstance()->getJobSystem()->getWorkerCount());
+}
+
+// Every bullet tests itself against every enemy, so this is the B x E term of a busy tick
+void SimulationBenchmarks::bulletCollision(BenchmarkState& state) {
+	WorldSnapshot scenario;
+	buildScenario(scenario, state.getArgument(1), state.getArgument(0));
+
+	while (state.keepRunning()) {
+		restoreIfDue(state, scenario);
+
+		for (auto& bullet : Bullet::bullets) {
+			bullet->update();
+		}
+	}
+
+	state.setCounter("pairs", static_cast<double>(state.getArgument(0)) * state.getArgument(1));
+}
+
+void SimulationBenchmarks::minimapCapture(BenchmarkState& state) {
+	WorldSnapshot scenario;
+	buildScenario(scenario, state.getArgument(0), state.getArgument(0) / 10);
+	scenario.apply();
+
+	MinimapRenderState minimap;
+
+	while (state.keepRunning()) {
+		Minimap::getInstance()->capture(minimap);
+	}
+}
+
+void SimulationBenchmarks::minimapRender(BenchmarkState& state) {
+	WorldSnapshot scenario;
+	buildScenario(scenario, state.getArgument(0), state.getArgument(0) / 10);
+	scenario.apply();
+
+	MinimapRenderState minimap;
+	Minimap::getInstance()->capture(minimap);
+
+	while (state.keepRunning()) {
+		Minimap::getInstance()->render(minimap);
+	}
+}
+
+// Clone and release, the way WaveManager spawns and removes enemies
+void SimulationBenchmarks::getPrototype(BenchmarkState& state, Prototype_Type type) {
+	PrototypeRegistry* registry = PrototypeRegistry::getInstance();
+
+	while (state.keepRunning()) {
+		std::shared_ptr<Prototype> clone = registry->getPrototype(type);
+	}
+}
+
+// Alternates between two strings so every iteration re-rasterizes, like a HUD value changing
+void SimulationBenchmarks::loadText(BenchmarkState& state) {
+	const size_t length = static_cast<size_t>(state.getArgument(0));
+	const std::string texts[2] = { std::string(length, '0'), std::string(length, '8') };
+
+	Text text;
+	text.setFont(Font::MOTION_CONTROL_BOLD);
+	text.setColor({ 0, 0, 0, 255 });
+
+	while (state.keepRunning()) {
+		text.setText(texts[state.getIteration() % 2]);
+		text.loadText();
+	}
+}
+
+void SimulationBenchmarks::registerAll() {
+	Benchmark::add("initWave", initWave, { { 10 }, { 30 }, { 60 } });
+	Benchmark::add("updateEnemies", updateEnemies, { { 100 }, { 500 }, { 2000 } });
+	Benchmark::add("bulletCollision", bulletCollision, { { 64, 256 }, { 64, 1024 }, { 256, 256 }, { 256, 1024 } });
+	Benchmark::add("minimapCapture", minimapCapture, { { 500 }, { 2000 } });
+	Benchmark::add("minimapRender", minimapRender, { { 500 }, { 2000 } });
+
+	for (const auto& prototype : NAMED_PROTOTYPES) {
+		const Prototype_Type type = prototype.type;
+		Benchmark::add(std::string("getPrototype/") + prototype.name, [type](BenchmarkState& state) {
+			getPrototype(state, type);
+		});
+	}
+
+	Benchmark::add("loadText", loadText, { { SAMPLE_TEXT_LENGTH_SHORT }, { SAMPLE_TEXT_LENGTH_LONG } });
+}
+
+int SimulationBenchmarks::run(int argc, char* argv[]) {
+	registerAll();
+
+	std::cout << "Simulation benchmarks: " << Game::getInstance()->getJobSystem()->getWorkerCount() << " workers, seed "
+		<< SCENARIO_SEED << '\n';
+
+	return Benchmark::runAll(argc, argv);
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <SDL.h>
+#include "GameEnums.h"
+
+struct WorldSnapshot;
+class BenchmarkState;
+
+// Hot paths of a gameplay tick on seeded scenarios, so two runs of the same build spawn the same world.
+// Needs Game::initAll for prototypes, textures, fonts and the world size; runs fine headless.
+class SimulationBenchmarks {
+private:
+	constexpr static Uint32 SCENARIO_SEED = 1337;
+	constexpr static int RESTORE_INTERVAL_TICKS = 60; // Scenario is restored this often so the crowd keeps its shape
+	constexpr static int SAMPLE_TEXT_LENGTH_SHORT = 12;
+	constexpr static int SAMPLE_TEXT_LENGTH_LONG = 48;
+
+private:
+	static void buildScenario(WorldSnapshot& scenario, int enemyCount, int bulletCount);
+	static void restoreIfDue(BenchmarkState& state, const WorldSnapshot& scenario);
+
+	static void initWave(BenchmarkState& state);
+	static void updateEnemies(BenchmarkState& state);
+	static void bulletCollision(BenchmarkState& state);
+	static void minimapCapture(BenchmarkState& state);
+	static void minimapRender(BenchmarkState& state);
+	static void getPrototype(BenchmarkState& state, Prototype_Type type);
+	static void loadText(BenchmarkState& state);
+
+	static void registerAll();
+
+public:
+	// argv is forwarded to Benchmark::runAll, returns the process exit code
+	static int run(int argc, char* argv[]);
+};
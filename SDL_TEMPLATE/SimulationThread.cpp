@@ -0,0 +1,55 @@
+#include "SimulationThread.h"
+#include "FrameArena.h"
+
+SimulationThread::SimulationThread() : tickQueued(false), tickRunning(false), running(true) {
+	thread = std::thread(&SimulationThread::threadLoop, this);
+}
+
+SimulationThread::~SimulationThread() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		running = false;
+	}
+	condition.notify_all();
+
+	thread.join();
+}
+
+void SimulationThread::threadLoop() {
+	std::unique_lock<std::mutex> lock(mutex);
+
+	while (true) {
+		condition.wait(lock, [this] { return !running || tickRunning; });
+
+		if (!running) return;
+
+		lock.unlock();
+		FrameArena::getThreadArena().reset();
+		tick();
+		lock.lock();
+
+		tickRunning = false;
+		condition.notify_all();
+	}
+}
+
+void SimulationThread::startTick(std::function<void()> tick) {
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		condition.wait(lock, [this] { return !tickRunning; });
+
+		this->tick = std::move(tick);
+		tickQueued = true;
+		tickRunning = true;
+	}
+	condition.notify_all();
+}
+
+bool SimulationThread::waitForTick() {
+	std::unique_lock<std::mutex> lock(mutex);
+	condition.wait(lock, [this] { return !tickRunning; });
+
+	bool finishedTick = tickQueued;
+	tickQueued = false;
+	return finishedTick;
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+// Runs one simulation tick at a time off the main thread, the main thread joins it before touching the world
+class SimulationThread {
+public:
+	SimulationThread();
+	~SimulationThread();
+
+	SimulationThread(const SimulationThread&) = delete;
+	SimulationThread& operator=(const SimulationThread&) = delete;
+	SimulationThread(SimulationThread&&) = delete;
+	SimulationThread& operator=(SimulationThread&&) = delete;
+
+private:
+	std::thread thread;
+	std::mutex mutex;
+	std::condition_variable condition;
+	std::function<void()> tick;
+	bool tickQueued;
+	bool tickRunning;
+	bool running;
+
+private:
+	void threadLoop();
+
+public:
+	void startTick(std::function<void()> tick);
+	// Returns true when a tick had been started since the last wait
+	bool waitForTick();
+};
@@ -0,0 +1,176 @@
+#include "SoakTest.h"
+#include "Game.h"
+#include "GameState.h"
+#include "GameClock.h"
+#include "GameRandom.h"
+#include "GameSound.h"
+#include "InvokerPlaying.h"
+#include "Player.h"
+#include "Bullet.h"
+#include "EnemyType.h"
+#include "WaveManager.h"
+#include "FrameArena.h"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace {
+	constexpr int BOT_HEART_AMOUNT = 1000000; // Refilled every tick, so the bot outlives any wave
+}
+
+// Aims every player at the enemy nearest to it, the same direction vector the mouse aim in GamePlaying::input sets
+void SoakTest::aimBot() {
+	const auto& enemies = WaveManager::getInstance()->getEnemies();
+
+	for (auto& entry : InvokerPlaying::getInstance()->players) {
+		Player& player = *entry.second;
+		*player.heartAmount = BOT_HEART_AMOUNT;
+
+		const SDL_Point& origin = *player.platformPosition;
+		float nearestX = 0.0F;
+		float nearestY = 0.0F;
+		float nearestDistance = -1.0F;
+
+		for (const auto& enemy : enemies) {
+			const float dx = static_cast<float>(enemy->getPosition().x + enemy->getDimension().x / 2 - origin.x);
+			const float dy = static_cast<float>(enemy->getPosition().y + enemy->getDimension().y / 2 - origin.y);
+			const float distance = dx * dx + dy * dy;
+
+			if (nearestDistance < 0.0F || distance < nearestDistance) {
+				nearestDistance = distance;
+				nearestX = dx;
+				nearestY = dy;
+			}
+		}
+
+		if (nearestDistance <= 0.0F) continue;
+
+		const float magnitude = std::sqrt(nearestDistance);
+		*player.directionX = nearestX / magnitude;
+		*player.directionY = nearestY / magnitude;
+	}
+}
+
+void SoakTest::recordTick(std::vector<WaveStats>& waves, int wave, Uint64 tickNs) {
+	if (waves.empty() || waves.back().wave != wave) waves.push_back({ wave, 0, 0, 0, 0, 0 });
+
+	WaveStats& stats = waves.back();
+	stats.ticks++;
+	stats.totalTickNs += tickNs;
+	if (tickNs > stats.worstTickNs) stats.worstTickNs = tickNs;
+
+	const size_t enemyCount = WaveManager::getInstance()->getEnemies().size();
+	if (enemyCount > stats.peakEnemies) stats.peakEnemies = enemyCount;
+	if (Bullet::bullets.size() > stats.peakBullets) stats.peakBullets = Bullet::bullets.size();
+}
+
+void SoakTest::printWave(const WaveStats& stats) {
+	std::cout << "  wave " << stats.wave << ": " << stats.ticks << " ticks, avg "
+		<< stats.totalTickNs / 1000.0 / stats.ticks << " us, worst " << stats.worstTickNs / 1000.0 << " us, "
+		<< stats.peakEnemies << " enemies, " << stats.peakBullets << " bullets" << '\n';
+}
+
+bool SoakTest::writeJson(const char* path, const std::vector<WaveStats>& waves, double speed) {
+	std::ofstream out(path);
+	if (!out) return false;
+
+	out << "{\n  \"seed\": " << SOAK_SEED << ",\n  \"ticks_per_second\": " << TICKS_PER_SECOND;
+	out << ",\n  \"achieved_speed\": " << speed << ",\n  \"waves\": [";
+
+	for (size_t waveIndex = 0; waveIndex < waves.size(); waveIndex++) {
+		const WaveStats& stats = waves[waveIndex];
+
+		out << (waveIndex == 0 ? "\n" : ",\n") << "    { \"wave\": " << stats.wave << ", \"ticks\": " << stats.ticks
+			<< ", \"mean_tick_ns\": " << stats.totalTickNs / stats.ticks << ", \"worst_tick_ns\": " << stats.worstTickNs
+			<< ", \"peak_enemies\": " << stats.peakEnemies << ", \"peak_bullets\": " << stats.peakBullets << " }";
+	}
+
+	out << "\n  ]\n}\n";
+	return true;
+}
+
+int SoakTest::run(int argc, char* argv[]) {
+	int targetWave = DEFAULT_TARGET_WAVE;
+	double speed = DEFAULT_SPEED;
+	const char* outPath = DEFAULT_OUT_PATH;
+
+	for (int argIndex = 1; argIndex < argc; argIndex++) {
+		const char* arg = argv[argIndex];
+
+		if (std::strncmp(arg, "--soak_waves=", 13) == 0) targetWave = std::atoi(arg + 13);
+		else if (std::strncmp(arg, "--soak_speed=", 13) == 0) speed = std::atof(arg + 13);
+		else if (std::strncmp(arg, "--soak_out=", 11) == 0) outPath = arg + 11;
+	}
+
+	GameClock* clock = GameClock::getInstance();
+	WaveManager* waveManager = WaveManager::getInstance();
+
+	GameRandom::seed(SOAK_SEED);
+	Game::getInstance()->startGame();
+	clock->setManualStepping(true);
+	waveManager->setFixedSpawnRelease(true);
+	InvokerPlaying::getInstance()->pressButton(Command_Actions::fire);
+
+	std::cout << "Soak test: up to wave " << targetWave << ", ";
+	if (speed > 0.0) std::cout << speed << "x real time" << '\n';
+	else std::cout << "uncapped" << '\n';
+
+	GamePlaying playing;
+	std::vector<WaveStats> waves;
+	const Uint64 tickNs = GameClock::NANOSECONDS_PER_SECOND / TICKS_PER_SECOND;
+	const Uint64 startRealNs = GameClock::getRealTimeNs();
+	Uint64 tickCount = 0;
+	int ticksInWave = 0;
+
+	while (waveManager->getWaveCount() <= targetWave) {
+		FrameArena::getThreadArena().reset();
+		GameSound::getInstance()->beginFrame();
+		clock->step(tickNs);
+		aimBot();
+
+		const int wave = waveManager->getWaveCount();
+		const Uint64 tickStart = GameClock::getRealTimeNs();
+		playing.update();
+		const Uint64 tickCost = GameClock::getRealTimeNs() - tickStart;
+
+		if (!waves.empty() && waves.back().wave != wave) {
+			printWave(waves.back());
+			ticksInWave = 0;
+		}
+		recordTick(waves, wave, tickCost);
+		tickCount++;
+
+		if (++ticksInWave > MAX_TICKS_PER_WAVE) {
+			std::cout << "Wave " << wave << " not cleared after " << MAX_TICKS_PER_WAVE / TICKS_PER_SECOND << " s of game time, stopping" << '\n';
+			break;
+		}
+
+		// Capped runs sleep off whatever they are ahead of the requested multiple of real time
+		if (speed > 0.0) {
+			const Uint64 dueNs = static_cast<Uint64>(tickCount * tickNs / speed);
+			const Uint64 elapsedNs = GameClock::getRealTimeNs() - startRealNs;
+
+			if (dueNs > elapsedNs + GameClock::NANOSECONDS_PER_MILLISECOND) {
+				SDL_Delay(static_cast<Uint32>((dueNs - elapsedNs) / GameClock::NANOSECONDS_PER_MILLISECOND));
+			}
+		}
+	}
+
+	if (!waves.empty()) printWave(waves.back());
+	clock->setManualStepping(false);
+	waveManager->setFixedSpawnRelease(false);
+
+	const Uint64 realNs = GameClock::getRealTimeNs() - startRealNs;
+	const double achievedSpeed = realNs > 0 ? static_cast<double>(tickCount * tickNs) / realNs : 0.0;
+	std::cout << "Soak test: " << tickCount << " ticks, " << achievedSpeed << "x real time" << '\n';
+
+	if (!writeJson(outPath, waves, achievedSpeed)) {
+		std::cerr << "Failed to open soak output " << outPath << '\n';
+		return 1;
+	}
+
+	std::cout << "Soak results written to " << outPath << '\n';
+	return 0;
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <SDL.h>
+#include <vector>
+
+// Plays real waves headless on a manually stepped GameClock, with an immortal auto-aim bot holding the trigger,
+// and reports how the cost of one GamePlaying tick grows with the wave count. Needs Game::initAll.
+class SoakTest {
+private:
+	constexpr static Uint32 SOAK_SEED = 1337;
+	constexpr static int TICKS_PER_SECOND = 60;
+	constexpr static int DEFAULT_TARGET_WAVE = 40;
+	constexpr static double DEFAULT_SPEED = 0.0; // Multiple of real time, zero runs uncapped
+	constexpr static int MAX_TICKS_PER_WAVE = TICKS_PER_SECOND * 60 * 5; // Gives up on a wave the bot can't clear
+	constexpr static const char* DEFAULT_OUT_PATH = "soak_results.json";
+
+	struct WaveStats {
+		int wave;
+		int ticks;
+		Uint64 totalTickNs;
+		Uint64 worstTickNs;
+		size_t peakEnemies;
+		size_t peakBullets;
+	};
+
+private:
+	static void aimBot();
+	static void recordTick(std::vector<WaveStats>& waves, int wave, Uint64 tickNs);
+	static void printWave(const WaveStats& stats);
+	static bool writeJson(const char* path, const std::vector<WaveStats>& waves, double speed);
+
+public:
+	// Understands --soak_waves=<wave>, --soak_speed=<multiple of real time> and --soak_out=<path>
+	static int run(int argc, char* argv[]);
+};
@@ -0,0 +1,73 @@
+#include "SpatialGrid.h"
+#include <algorithm>
+
+SpatialGrid::SpatialGrid() : bounds(nullptr), cellSize(MIN_CELL_SIZE), columns(1), rows(1) {}
+
+int SpatialGrid::getCellCoordinate(int worldCoordinate, int cellCount) const {
+	return std::min(std::max(worldCoordinate / cellSize, 0), cellCount - 1);
+}
+
+void SpatialGrid::build(const std::vector<SDL_Rect>& bounds, const SDL_Point& worldDimension, int minCellSize) {
+	this->bounds = &bounds;
+
+	cellSize = minCellSize;
+	for (const auto& rect : bounds) {
+		cellSize = std::max(cellSize, std::max(rect.w, rect.h));
+	}
+
+	columns = std::max(1, (worldDimension.x + cellSize - 1) / cellSize);
+	rows = std::max(1, (worldDimension.y + cellSize - 1) / cellSize);
+
+	cellStart.assign(columns * rows + 1, 0);
+	entryCell.resize(bounds.size());
+	cellEntries.resize(bounds.size());
+
+	for (size_t index = 0; index < bounds.size(); index++) {
+		const SDL_Rect& rect = bounds[index];
+		const int column = getCellCoordinate(rect.x + rect.w / 2, columns);
+		const int row = getCellCoordinate(rect.y + rect.h / 2, rows);
+
+		entryCell[index] = row * columns + column;
+		++cellStart[entryCell[index] + 1];
+	}
+
+	for (size_t cell = 1; cell < cellStart.size(); cell++) {
+		cellStart[cell] += cellStart[cell - 1];
+	}
+
+	cellFill.assign(cellStart.begin(), cellStart.end() - 1);
+	for (size_t index = 0; index < bounds.size(); index++) {
+		cellEntries[cellFill[entryCell[index]]++] = index;
+	}
+}
+
+const SDL_Rect& SpatialGrid::getBounds(size_t index) const {
+	return (*bounds)[index];
+}
+
+void SpatialGrid::getSeparationPush(size_t index, float& pushX, float& pushY) const {
+	const SDL_Rect& self = getBounds(index);
+	const float selfCenterX = self.x + self.w * 0.5F;
+	const float selfCenterY = self.y + self.h * 0.5F;
+
+	pushX = 0.0F;
+	pushY = 0.0F;
+
+	forEachNeighbor(index, [&](size_t otherIndex) {
+		const SDL_Rect& other = getBounds(otherIndex);
+		if (!SDL_HasIntersection(&self, &other)) return;
+
+		const float overlapX = static_cast<float>(std::min(self.x + self.w, other.x + other.w) - std::max(self.x, other.x));
+		const float overlapY = static_cast<float>(std::min(self.y + self.h, other.y + other.h) - std::max(self.y, other.y));
+		const float offsetX = selfCenterX - (other.x + other.w * 0.5F);
+		const float offsetY = selfCenterY - (other.y + other.h * 0.5F);
+
+		if (overlapX < overlapY) {
+			float side = offsetX != 0.0F ? (offsetX > 0.0F ? 1.0F : -1.0F) : (index < otherIndex ? -1.0F : 1.0F);
+			pushX += side * overlapX * 0.5F;
+		} else {
+			float side = offsetY != 0.0F ? (offsetY > 0.0F ? 1.0F : -1.0F) : (index < otherIndex ? -1.0F : 1.0F);
+			pushY += side * overlapY * 0.5F;
+		}
+	});
+}
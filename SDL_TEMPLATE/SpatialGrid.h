@@ -0,0 +1,68 @@
+#pragma once
+#include <SDL.h>
+#include <vector>
+
+// Uniform grid over the world, rebuilt every tick from a bounds snapshot.
+// Entries are bucketed by center with a counting sort, so each cell lists its entries in index order.
+class SpatialGrid {
+private:
+	constexpr static int MIN_CELL_SIZE = 32;
+
+	const std::vector<SDL_Rect>* bounds;
+	int cellSize;
+	int columns;
+	int rows;
+	std::vector<int> cellStart; // Entries of cell c are cellEntries[cellStart[c] .. cellStart[c + 1])
+	std::vector<size_t> cellEntries;
+	std::vector<int> entryCell;
+	std::vector<int> cellFill;
+
+private:
+	int getCellCoordinate(int worldCoordinate, int cellCount) const;
+
+	template <typename Visitor>
+	void forEachInBlock(int cell, Visitor visitor) const {
+		const int column = cell % columns;
+		const int row = cell / columns;
+
+		for (int neighborRow = row - 1; neighborRow <= row + 1; neighborRow++) {
+			if (neighborRow < 0 || neighborRow >= rows) continue;
+
+			for (int neighborColumn = column - 1; neighborColumn <= column + 1; neighborColumn++) {
+				if (neighborColumn < 0 || neighborColumn >= columns) continue;
+
+				const int neighborCell = neighborRow * columns + neighborColumn;
+				for (int entry = cellStart[neighborCell]; entry < cellStart[neighborCell + 1]; entry++) {
+					visitor(cellEntries[entry]);
+				}
+			}
+		}
+	}
+
+public:
+	SpatialGrid();
+
+	// Cells are at least as large as the largest entry, so overlapping entries are always in adjacent cells.
+	// Raise minCellSize to the largest rect later passed to forEachNear.
+	void build(const std::vector<SDL_Rect>& bounds, const SDL_Point& worldDimension, int minCellSize = MIN_CELL_SIZE);
+
+	const SDL_Rect& getBounds(size_t index) const;
+
+	// Half the penetration into every overlapping entry, along the shallower axis, ties split by index
+	void getSeparationPush(size_t index, float& pushX, float& pushY) const;
+
+	template <typename Visitor>
+	void forEachNeighbor(size_t index, Visitor visitor) const {
+		forEachInBlock(entryCell[index], [index, &visitor](size_t other) {
+			if (other != index) visitor(other);
+		});
+	}
+
+	// Entries that can overlap a rect centered on the point, as long as it is no larger than a cell
+	template <typename Visitor>
+	void forEachNear(const SDL_Point& point, Visitor visitor) const {
+		if (!bounds || bounds->empty()) return;
+
+		forEachInBlock(getCellCoordinate(point.y, rows) * columns + getCellCoordinate(point.x, columns), visitor);
+	}
+};
@@ -0,0 +1,129 @@
+#include "SpawnPlacement.h"
+#include "GameEnums.h"
+#include "GameRandom.h"
+#include <algorithm>
+#include <random>
+
+SpawnPlacement::SpawnPlacement() : cellSize(1), columns(1), rows(1) {}
+
+bool SpawnPlacement::sparesPlayers(const SDL_Rect& rect, const std::vector<SDL_Point>& platforms) {
+	for (const auto& platform : platforms) {
+		// Distance from the platform to the closest point of the rect
+		const int closestX = std::min(std::max(platform.x, rect.x), rect.x + rect.w);
+		const int closestY = std::min(std::max(platform.y, rect.y), rect.y + rect.h);
+		const Sint64 dx = closestX - platform.x;
+		const Sint64 dy = closestY - platform.y;
+
+		if (dx * dx + dy * dy < static_cast<Sint64>(PLAYER_SAFE_RADIUS) * PLAYER_SAFE_RADIUS) return false;
+	}
+
+	return true;
+}
+
+void SpawnPlacement::resetGrid(const SDL_Point& worldDimension, int largestSide) {
+	cellSize = std::max(largestSide + SPAWN_GAP, 1);
+	columns = std::max(worldDimension.x / cellSize + 1, 1);
+	rows = std::max(worldDimension.y / cellSize + 1, 1);
+
+	placed.clear();
+	nextInCell.clear();
+	cellHead.assign(static_cast<size_t>(columns) * rows, -1);
+}
+
+// Rects are bucketed by center, which may lie outside the world for obstacles pushed past the border
+int SpawnPlacement::getCell(const SDL_Rect& rect) const {
+	const int column = std::min(std::max((rect.x + rect.w / 2) / cellSize, 0), columns - 1);
+	const int row = std::min(std::max((rect.y + rect.h / 2) / cellSize, 0), rows - 1);
+	return row * columns + column;
+}
+
+void SpawnPlacement::insert(const SDL_Rect& rect) {
+	const int cell = getCell(rect);
+
+	placed.push_back(rect);
+	nextInCell.push_back(cellHead[cell]);
+	cellHead[cell] = static_cast<int>(placed.size()) - 1;
+}
+
+bool SpawnPlacement::isCrowded(const SDL_Rect& rect) const {
+	const int cell = getCell(rect);
+	const int column = cell % columns;
+	const int row = cell / columns;
+
+	for (int neighborRow = std::max(row - 1, 0); neighborRow <= std::min(row + 1, rows - 1); neighborRow++) {
+		for (int neighborColumn = std::max(column - 1, 0); neighborColumn <= std::min(column + 1, columns - 1); neighborColumn++) {
+			for (int index = cellHead[neighborRow * columns + neighborColumn]; index >= 0; index = nextInCell[index]) {
+				const SDL_Rect& other = placed[index];
+
+				if (rect.x < other.x + other.w + SPAWN_GAP && other.x < rect.x + rect.w + SPAWN_GAP &&
+					rect.y < other.y + other.h + SPAWN_GAP && other.y < rect.y + rect.h + SPAWN_GAP) {
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+void SpawnPlacement::place(const std::vector<SDL_Point>& dimensions, const std::vector<SDL_Rect>& obstacles,
+	const std::vector<SDL_Point>& platforms, const SDL_Point& worldDimension, std::vector<SDL_Point>& positions) {
+	positions.resize(dimensions.size());
+	if (dimensions.empty()) return;
+
+	int largestSide = 0;
+	for (const auto& dimension : dimensions) {
+		largestSide = std::max(largestSide, std::max(dimension.x, dimension.y));
+	}
+	for (const auto& obstacle : obstacles) {
+		largestSide = std::max(largestSide, std::max(obstacle.w, obstacle.h));
+	}
+
+	resetGrid(worldDimension, largestSide);
+
+	for (const auto& obstacle : obstacles) {
+		insert(obstacle);
+	}
+
+	order.resize(dimensions.size());
+	for (size_t index = 0; index < order.size(); index++) {
+		order[index] = index;
+	}
+	std::stable_sort(order.begin(), order.end(), [&dimensions](size_t left, size_t right) {
+		return dimensions[left].x * dimensions[left].y > dimensions[right].x * dimensions[right].y;
+	});
+
+	std::mt19937& rng = GameRandom::getEngine();
+
+	for (const auto& index : order) {
+		const SDL_Point& dimension = dimensions[index];
+
+		std::uniform_int_distribution<int> distX(BORDER_ALLOWANCE,
+			std::max(worldDimension.x - BORDER_ALLOWANCE - dimension.x, BORDER_ALLOWANCE));
+		std::uniform_int_distribution<int> distY(BORDER_ALLOWANCE,
+			std::max(worldDimension.y - BORDER_ALLOWANCE - dimension.y, BORDER_ALLOWANCE));
+
+		SDL_Rect candidate = { 0, 0, dimension.x, dimension.y };
+		SDL_Rect fallback = candidate;
+		bool fallbackSparesPlayers = false;
+		bool found = false;
+
+		for (int attempt = 0; attempt < MAX_ATTEMPTS && !found; attempt++) {
+			candidate.x = distX(rng);
+			candidate.y = distY(rng);
+
+			const bool spares = sparesPlayers(candidate, platforms);
+			found = spares && !isCrowded(candidate);
+
+			if (spares || !fallbackSparesPlayers) {
+				fallback = candidate;
+				fallbackSparesPlayers = spares;
+			}
+		}
+
+		if (!found) candidate = fallback;
+
+		insert(candidate);
+		positions[index] = { candidate.x, candidate.y };
+	}
+}
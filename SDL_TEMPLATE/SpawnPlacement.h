@@ -0,0 +1,38 @@
+#pragma once
+#include <SDL.h>
+#include <vector>
+
+// Places a whole wave in one batch by Poisson-disk dart throwing. Candidates are uniform over the world inside
+// BORDER_ALLOWANCE, and one is kept only when it stays SPAWN_GAP clear of every enemy already standing or placed
+// and PLAYER_SAFE_RADIUS away from every player's platform. Larger enemies go first while there is still room.
+// An enemy that finds no free spot in MAX_ATTEMPTS candidates takes its last one that spares the players,
+// or its last one at all, so a crowded wave still spawns in full.
+class SpawnPlacement {
+private:
+	constexpr static int SPAWN_GAP = 6;
+	constexpr static int PLAYER_SAFE_RADIUS = 220; // From a platform to the nearest edge of a spawned enemy
+	constexpr static int MAX_ATTEMPTS = 30;
+
+	std::vector<SDL_Rect> placed; // Obstacles first, then the batch in placement order
+	std::vector<int> cellHead; // Last rect inserted into each cell, -1 when empty
+	std::vector<int> nextInCell;
+	std::vector<size_t> order; // Batch indices, largest first
+	int cellSize; // Larger than any rect plus SPAWN_GAP, so rects too close are always in adjacent cells
+	int columns;
+	int rows;
+
+private:
+	static bool sparesPlayers(const SDL_Rect& rect, const std::vector<SDL_Point>& platforms);
+
+	void resetGrid(const SDL_Point& worldDimension, int largestSide);
+	int getCell(const SDL_Rect& rect) const;
+	void insert(const SDL_Rect& rect);
+	bool isCrowded(const SDL_Rect& rect) const;
+
+public:
+	SpawnPlacement();
+
+	// positions[i] receives the top-left world position of an enemy of dimensions[i]
+	void place(const std::vector<SDL_Point>& dimensions, const std::vector<SDL_Rect>& obstacles,
+		const std::vector<SDL_Point>& platforms, const SDL_Point& worldDimension, std::vector<SDL_Point>& positions);
+};
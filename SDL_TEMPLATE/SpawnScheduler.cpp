@@ -0,0 +1,54 @@
+#include "SpawnScheduler.h"
+
+SpawnScheduler::SpawnScheduler() : head(0), pendingCount(0), nextPosition(0), fixedRelease(false) {}
+
+void SpawnScheduler::queue(Prototype_Type type, int count) {
+	if (count <= 0) return;
+
+	pending.push_back({ type, count });
+	pendingCount += count;
+}
+
+// Keeps the capacity, the next wave queues about as many runs
+void SpawnScheduler::clear() {
+	pending.clear();
+	head = 0;
+	pendingCount = 0;
+	positions.clear();
+	nextPosition = 0;
+}
+
+bool SpawnScheduler::isEmpty() const {
+	return pendingCount == 0;
+}
+
+int SpawnScheduler::getPendingCount() const {
+	return pendingCount;
+}
+
+void SpawnScheduler::setFixedRelease(bool fixedRelease) {
+	this->fixedRelease = fixedRelease;
+}
+
+void SpawnScheduler::assignPositions(std::vector<SDL_Point>& placedPositions) {
+	positions.swap(placedPositions);
+	nextPosition = 0;
+}
+
+void SpawnScheduler::save(std::vector<PendingSpawn>& spawns, std::vector<SDL_Point>& spawnPositions) const {
+	spawns.assign(pending.begin() + head, pending.end());
+
+	if (nextPosition < positions.size()) spawnPositions.assign(positions.begin() + nextPosition, positions.end());
+	else spawnPositions.clear();
+}
+
+void SpawnScheduler::restore(const std::vector<PendingSpawn>& spawns, const std::vector<SDL_Point>& spawnPositions) {
+	clear();
+
+	for (const auto& spawn : spawns) {
+		queue(spawn.type, spawn.count);
+	}
+
+	// A mismatched count would pair enemies with the wrong spots, release them unplaced instead
+	if (spawnPositions.size() == static_cast<size_t>(pendingCount)) positions.assign(spawnPositions.begin(), spawnPositions.end());
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <SDL.h>
+#include <vector>
+#include "GameEnums.h"
+#include "GameClock.h"
+
+struct PendingSpawn {
+	Prototype_Type type;
+	int count;
+};
+
+// Holds a wave's spawns and releases them over several ticks instead of all on the tick the countdown ends,
+// each at the position placed for it when the wave was queued.
+// A tick releases enemies until SPAWN_BUDGET_NS is spent, never fewer than MIN_SPAWNS_PER_TICK so a slow machine
+// still finishes. With fixed release on it releases a fixed count instead, keeping seeded soak runs reproducible.
+class SpawnScheduler {
+private:
+	constexpr static Uint64 SPAWN_BUDGET_NS = 1000000;
+	constexpr static int MIN_SPAWNS_PER_TICK = 4;
+	constexpr static int FIXED_SPAWNS_PER_TICK = 24;
+
+	std::vector<PendingSpawn> pending; // Runs of one type, in spawn order
+	size_t head; // First run with enemies left
+	int pendingCount;
+	std::vector<SDL_Point> positions; // One per pending enemy in release order, empty when not placed
+	size_t nextPosition;
+	bool fixedRelease;
+
+public:
+	SpawnScheduler();
+
+	void queue(Prototype_Type type, int count);
+	void clear();
+	bool isEmpty() const;
+	int getPendingCount() const;
+	void setFixedRelease(bool fixedRelease);
+
+	// Swaps in one position per pending enemy, in release order
+	void assignPositions(std::vector<SDL_Point>& placedPositions);
+
+	// Saves the unreleased runs with their placed positions, restore puts both back without placing again
+	void save(std::vector<PendingSpawn>& spawns, std::vector<SDL_Point>& spawnPositions) const;
+	void restore(const std::vector<PendingSpawn>& spawns, const std::vector<SDL_Point>& spawnPositions);
+
+	template <typename RunFunction>
+	void forEachPendingRun(RunFunction visit) const {
+		for (size_t runIndex = head; runIndex < pending.size(); runIndex++) {
+			visit(pending[runIndex].type, pending[runIndex].count);
+		}
+	}
+
+	// Calls spawn(type, position) for every enemy released this tick, or for all of them when unbudgeted.
+	// position is null when the queue was never placed.
+	template <typename SpawnFunction>
+	void release(SpawnFunction spawn, bool unbudgeted = false) {
+		const Uint64 startNs = GameClock::getRealTimeNs();
+		int released = 0;
+
+		while (pendingCount > 0) {
+			if (!unbudgeted) {
+				if (fixedRelease && released == FIXED_SPAWNS_PER_TICK) break;
+				if (!fixedRelease && released >= MIN_SPAWNS_PER_TICK && GameClock::getRealTimeNs() - startNs >= SPAWN_BUDGET_NS) break;
+			}
+
+			PendingSpawn& run = pending[head];
+			spawn(run.type, nextPosition < positions.size() ? &positions[nextPosition] : nullptr);
+			nextPosition++;
+			released++;
+			pendingCount--;
+
+			if (--run.count == 0) head++;
+		}
+
+		if (pendingCount == 0) clear();
+	}
+};
@@ -0,0 +1,39 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+
+// Bounded ring for exactly one producer and one consumer thread. push and pop never block or allocate,
+// a full queue rejects the push and leaves dropping to the caller.
+template <typename T, size_t Capacity>
+class SpscQueue {
+	static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+private:
+	T slots[Capacity];
+	alignas(64) std::atomic<size_t> head; // Next slot to pop, only the consumer writes it
+	alignas(64) std::atomic<size_t> tail; // Next slot to push, only the producer writes it
+
+public:
+	SpscQueue() : slots(), head(0), tail(0) {}
+
+	SpscQueue(const SpscQueue&) = delete;
+	SpscQueue& operator=(const SpscQueue&) = delete;
+
+	bool push(const T& value) {
+		const size_t currentTail = tail.load(std::memory_order_relaxed);
+		if (currentTail - head.load(std::memory_order_acquire) == Capacity) return false;
+
+		slots[currentTail & (Capacity - 1)] = value;
+		tail.store(currentTail + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool pop(T& value) {
+		const size_t currentHead = head.load(std::memory_order_relaxed);
+		if (currentHead == tail.load(std::memory_order_acquire)) return false;
+
+		value = slots[currentHead & (Capacity - 1)];
+		head.store(currentHead + 1, std::memory_order_release);
+		return true;
+	}
+};
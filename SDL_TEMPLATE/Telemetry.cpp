@@ -0,0 +1,194 @@
+#include "Telemetry.h"
+#include "Game.h"
+#include "GameClock.h"
+#include "GameSound.h"
+#include "WaveManager.h"
+#include "Bullet.h"
+#include "Logger.h"
+#include "RenderStats.h"
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+Telemetry::Telemetry() : writerRunning(false), file(nullptr), socketFd(-1), enabled(false), current(), dropped(0) {}
+
+Telemetry::~Telemetry() {
+	stop();
+}
+
+Telemetry* Telemetry::getInstance() {
+	static Telemetry instance;
+	return &instance;
+}
+
+bool Telemetry::openSocket(const char* path) {
+#ifdef _WIN32
+	LOG_ERROR("Telemetry sockets are not supported on Windows, stream to a file instead");
+	return false;
+#else
+	sockaddr_un address{};
+	address.sun_family = AF_UNIX;
+
+	if (SDL_strlen(path) >= sizeof(address.sun_path)) {
+		LOG_ERROR("Telemetry socket path too long: %s", path);
+		return false;
+	}
+	SDL_strlcpy(address.sun_path, path, sizeof(address.sun_path));
+
+	socketFd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (socketFd < 0) {
+		LOG_ERROR("Failed to create telemetry socket");
+		return false;
+	}
+
+	if (connect(socketFd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+		LOG_ERROR("Failed to connect telemetry socket %s", path);
+		::close(socketFd);
+		socketFd = -1;
+		return false;
+	}
+
+	return true;
+#endif
+}
+
+bool Telemetry::start(const std::string& target) {
+	if (enabled) return true;
+
+	const size_t prefixLength = SDL_strlen(SOCKET_PREFIX);
+
+	if (target.compare(0, prefixLength, SOCKET_PREFIX) == 0) {
+		if (!openSocket(target.c_str() + prefixLength)) return false;
+	} else {
+		file = SDL_RWFromFile(target.c_str(), "wb");
+		if (!file) {
+			LOG_ERROR("Failed to open telemetry output %s: %s", target.c_str(), SDL_GetError());
+			return false;
+		}
+	}
+
+	RenderStats::takeDrawCalls();
+	RenderStats::takeTextRasterizations();
+	current = FrameTelemetry();
+	dropped = 0;
+
+	enabled = true;
+	writerRunning.store(true, std::memory_order_release);
+	writerThread = std::thread(&Telemetry::writerLoop, this);
+
+	LOG_INFO("Telemetry streaming to %s", target.c_str());
+	return true;
+}
+
+// Records still queued are written before the sink closes
+void Telemetry::stop() {
+	if (!enabled) return;
+
+	writerRunning.store(false, std::memory_order_release);
+	writerThread.join();
+	closeSink();
+	enabled = false;
+}
+
+bool Telemetry::isEnabled() const {
+	return enabled;
+}
+
+void Telemetry::closeSink() {
+	if (file) {
+		SDL_RWclose(file);
+		file = nullptr;
+	}
+
+#ifndef _WIN32
+	if (socketFd >= 0) {
+		::close(socketFd);
+		socketFd = -1;
+	}
+#endif
+}
+
+bool Telemetry::write(const char* data, size_t size) {
+	if (file) return SDL_RWwrite(file, data, 1, size) == size;
+
+#ifndef _WIN32
+	// A reader that went away must not kill the game with SIGPIPE
+#ifdef MSG_NOSIGNAL
+	constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+	constexpr int SEND_FLAGS = 0;
+#endif
+
+	while (size > 0) {
+		const ssize_t sent = send(socketFd, data, size, SEND_FLAGS);
+		if (sent <= 0) return false;
+
+		data += sent;
+		size -= static_cast<size_t>(sent);
+	}
+	return true;
+#else
+	return false;
+#endif
+}
+
+void Telemetry::writerLoop() {
+	char line[LINE_CAPACITY];
+	FrameTelemetry record;
+	bool sinkOpen = true;
+
+	for (;;) {
+		// Read before draining, so records pushed right before stop are still written
+		const bool running = writerRunning.load(std::memory_order_acquire);
+
+		while (queue.pop(record)) {
+			if (!sinkOpen) continue;
+
+			const int length = SDL_snprintf(line, sizeof(line),
+				"{\"frame\":%llu,\"time_ns\":%llu,\"frame_ns\":%llu,\"update_ns\":%llu,\"render_ns\":%llu,"
+				"\"enemies\":%u,\"bullets\":%u,\"draw_calls\":%u,\"text_rasterizations\":%u,\"audio_voices\":%u,\"dropped\":%u}\n",
+				static_cast<unsigned long long>(record.frame), static_cast<unsigned long long>(record.timeNs),
+				static_cast<unsigned long long>(record.frameNs), static_cast<unsigned long long>(record.updateNs),
+				static_cast<unsigned long long>(record.renderNs), record.enemies, record.bullets, record.drawCalls,
+				record.textRasterizations, record.audioVoices, record.dropped);
+
+			if (length > 0 && !write(line, static_cast<size_t>(length))) {
+				LOG_WARNING("Telemetry output closed, dropping the rest of the stream");
+				sinkOpen = false;
+			}
+		}
+
+		if (!running) break;
+		SDL_Delay(WRITER_POLL_MS);
+	}
+}
+
+void Telemetry::beginFrame() {
+	if (!enabled) return;
+
+	current.enemies = static_cast<Uint32>(WaveManager::getInstance()->getEnemies().size());
+	current.bullets = static_cast<Uint32>(Bullet::bullets.size());
+	current.audioVoices = static_cast<Uint32>(GameSound::getInstance()->getActiveVoiceCount());
+	current.updateNs = Game::getInstance()->getLastUpdateNs();
+}
+
+void Telemetry::endFrame(Uint64 frameNs) {
+	const Uint32 frameDrawCalls = RenderStats::takeDrawCalls();
+	const Uint32 frameTextRasterizations = RenderStats::takeTextRasterizations();
+
+	if (!enabled) return;
+
+	current.frame++;
+	current.timeNs = GameClock::getRealTimeNs();
+	current.frameNs = frameNs;
+	current.renderNs = Game::getInstance()->getLastRenderNs();
+	current.drawCalls = frameDrawCalls;
+	current.textRasterizations = frameTextRasterizations;
+	current.dropped = dropped;
+
+	if (queue.push(current)) dropped = 0;
+	else dropped++;
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <SDL.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include "SpscQueue.h"
+
+struct FrameTelemetry {
+	Uint64 frame;
+	Uint64 timeNs;
+	Uint64 frameNs; // Whole loop iteration, limiter sleep included
+	Uint64 updateNs; // Last finished simulation tick
+	Uint64 renderNs;
+	Uint32 enemies;
+	Uint32 bullets;
+	Uint32 drawCalls;
+	Uint32 textRasterizations;
+	Uint32 audioVoices;
+	Uint32 dropped; // Records lost to a full queue since the previous one
+};
+
+// Per-frame NDJSON stream to a file or, outside Windows, a local UNIX socket. The main thread only fills a
+// record and pushes it on a lock-free queue, a writer thread formats and writes, so a slow reader never stalls a frame.
+class Telemetry {
+private:
+	Telemetry();
+	~Telemetry();
+
+public:
+	Telemetry(const Telemetry&) = delete;
+	Telemetry& operator=(const Telemetry&) = delete;
+	Telemetry(Telemetry&&) = delete;
+	Telemetry& operator=(Telemetry&&) = delete;
+
+	static Telemetry* getInstance();
+
+private:
+	constexpr static size_t QUEUE_CAPACITY = 1024; // About 17 seconds of frames at 60 FPS
+	constexpr static Uint32 WRITER_POLL_MS = 10;
+	constexpr static int LINE_CAPACITY = 512;
+	constexpr static const char* SOCKET_PREFIX = "unix:";
+
+	SpscQueue<FrameTelemetry, QUEUE_CAPACITY> queue;
+	std::thread writerThread;
+	std::atomic<bool> writerRunning;
+	SDL_RWops* file;
+	int socketFd;
+	bool enabled;
+	FrameTelemetry current;
+	Uint32 dropped;
+
+private:
+	bool openSocket(const char* path);
+	bool write(const char* data, size_t size);
+	void writerLoop();
+	void closeSink();
+
+public:
+	// A path, or unix:<socket path> to stream to a listening local socket
+	bool start(const std::string& target);
+	void stop();
+	bool isEnabled() const;
+
+	// Called after Game::input has joined the simulation tick, so the world can be read
+	void beginFrame();
+	void endFrame(Uint64 frameNs);
+};
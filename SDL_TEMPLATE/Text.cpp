@@ -1,5 +1,8 @@
 #include "Text.h"
-#include "Game.h"
+#include "GameHost.h"
+#include "AllocationTracker.h"
+#include "RenderStats.h"
+#include "Logger.h"
 
 std::unordered_map<std::string, std::shared_ptr<TTF_Font>> Text::fonts;
 
@@ -12,6 +15,8 @@ std::vector<Font> Text::getAllFonts() {
 }
 
 void Text::initFonts() {
+	AllocationTagScope allocationTag(Allocation_Tag::TEXT);
+
 	std::vector<Font> itFonts = getAllFonts();
 
 	for (const auto& font : itFonts) {
@@ -25,10 +30,10 @@ void Text::initFonts() {
 		);
 
 		if (!fontPtr) {
-			std::cerr << "Failed to load font: " << path << ": " << TTF_GetError() << "\n";
+			LOG_ERROR("Failed to load font %s: %s", path.c_str(), TTF_GetError());
 			continue;
 		} else {
-			std::cout << "Font " << path << " loaded." << '\n';
+			LOG_DEBUG("Font %s loaded.", path.c_str());
 		}
 
 		fonts[path] = fontPtr;
@@ -57,10 +62,22 @@ void Text::setFont(Font font) {
 	fontUsing = fonts[fontPath];
 }
 
-void Text::setText(std::string text) {
+void Text::setText(const std::string& text) {
+	AllocationTagScope allocationTag(Allocation_Tag::TEXT);
+
 	mText = text;
 }
 
+void Text::setText(const char* text) {
+	AllocationTagScope allocationTag(Allocation_Tag::TEXT);
+
+	mText = text;
+}
+
+const std::string& Text::getText() const {
+	return mText;
+}
+
 void Text::setDstRect(SDL_Rect dstRect) {
 	mDstRect = dstRect;
 }
@@ -69,36 +86,40 @@ void Text::setColor(SDL_Color color) {
 	mColor = color;
 }
 void Text::loadText() {
+	AllocationTagScope allocationTag(Allocation_Tag::TEXT);
+
 	mTexture.reset();
 
 	if (!fontUsing) {
-		std::cerr << "No font selected for rendering text!\n";
+		LOG_ERROR("No font selected for rendering text!");
 		return;
 	}
 
 	SDL_Surface* surface = TTF_RenderText_Solid(fontUsing.get(), mText.c_str(), mColor);
 	if (!surface) {
-		std::cerr << "Failed to render text surface: " << TTF_GetError() << '\n';
+		LOG_ERROR("Failed to render text surface: %s", TTF_GetError());
 		return;
 	}
 
-	SDL_Texture* texture = SDL_CreateTextureFromSurface(Game::getInstance()->getRenderer(), surface);
+	SDL_Texture* texture = SDL_CreateTextureFromSurface(GameHost::getInstance()->getRenderer(), surface);
 	SDL_FreeSurface(surface);
 
 	if (!texture) {
-		std::cerr << "Failed to create texture from surface: " << SDL_GetError() << '\n';
+		LOG_ERROR("Failed to create texture from surface: %s", SDL_GetError());
 		return;
 	}
 
 	mTexture.reset(texture);
+	RenderStats::countTextRasterization();
 }
 
 
 void Text::render() const {
 	if (!mTexture) {
-		std::cerr << "No texture to render!\n";
+		LOG_ERROR("No texture to render!");
 		return;
 	}
 
-	SDL_RenderCopy(Game::getInstance()->getRenderer(), mTexture.get(), nullptr, &mDstRect);
+	SDL_RenderCopy(GameHost::getInstance()->getRenderer(), mTexture.get(), nullptr, &mDstRect);
+	RenderStats::countDrawCalls(1);
 }
\ No newline at end of file
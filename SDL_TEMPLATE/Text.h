@@ -38,7 +38,9 @@ public:
 	~Text();
 
 	void setFont(Font font);
-	void setText(std::string text);
+	void setText(const std::string& text);
+	void setText(const char* text); // Reuses the stored string's capacity, no temporary std::string
+	const std::string& getText() const;
 	void setDstRect(SDL_Rect dstRect);
 	void setColor(SDL_Color color);
 	void loadText();
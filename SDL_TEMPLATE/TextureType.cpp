@@ -1,13 +1,14 @@
 #include "TextureType.h"
 #include "SDL_image.h"
-#include "Game.h"
+#include "GameHost.h"
+#include "Logger.h"
 
 void TextureType::checkTextureIfLoaded(const std::string& path) {
 	if (texture) {
-		std::cout << "Texture with path " << path << " loaded." << '\n';
+		LOG_DEBUG("Texture with path %s loaded.", path.c_str());
 		fetchTextureDimension();
 	} else {
-		std::cout << "Texture " << path << " failed to load: " << IMG_GetError() << '\n';
+		LOG_ERROR("Texture %s failed to load: %s", path.c_str(), IMG_GetError());
 	}
 }
 
@@ -18,7 +19,7 @@ void TextureType::fetchTextureDimension() {
 TextureType::TextureType(Prototype_Type type) {
 	std::string path = getProtoType_Type_Path(type);
 
-	texture = IMG_LoadTexture(Game::getInstance()->getRenderer(), path.c_str());
+	texture = IMG_LoadTexture(GameHost::getInstance()->getRenderer(), path.c_str());
 
 	checkTextureIfLoaded(path);
 }
@@ -7,8 +7,16 @@
 #include "InvokerPlaying.h"
 #include "Bar.h"
 #include "Text.h"
-#include "FastEnemy.h"
 #include "GameSound.h"
+#include "WorldSnapshot.h"
+#include "GameHost.h"
+#include "FrameArena.h"
+#include "JobSystem.h"
+#include "RenderList.h"
+#include "World.h"
+#include "AllocationTracker.h"
+#include "GameRandom.h"
+#include <algorithm>
 #include <random>
 #include <string>
 
@@ -26,7 +34,9 @@ std::unique_ptr<Text> WaveManager::playerScoreText = std::make_unique<Text>();
 
 std::unique_ptr<bool> WaveManager::waveCountFromLoadFile = std::make_unique<bool>(false);
 
-WaveManager::WaveManager() {}
+WaveManager::WaveManager() : ticksUntilFlowFieldRebuild(0), shownWaveCount(-1), shownScore(-1) {
+    waveTable.load();
+}
 
 SDL_Rect WaveManager::getCountdownTextDstRect() {
     SDL_Rect dstRect{ 0, 0, 300, 35 };
@@ -66,22 +76,6 @@ WaveManager* WaveManager::getInstance() {
     return &instance;
 }
 
-Uint32 WaveManager::getCountdownDuration() const {
-    Uint32 duration = 1000;
-
-    if (*waveCount <= 6) {
-        duration = 3500;
-    } else if (*waveCount <= 11) {
-        duration = 5000;
-    } else if (*waveCount <= 20) {
-        duration = 7000;
-    } else {
-        duration = 10000;
-    }
-
-    return duration;
-}
-
 void WaveManager::setCountdownMaxAmount(Uint32 duration) {
     float maxAmount = static_cast<float>(duration);
     countdownBar->setMaxAmount(maxAmount);
@@ -97,10 +91,6 @@ void WaveManager::initCountdownBar() {
     countdownBar->setProgressBarColor(COUNTDOWN_BAR_PROGRESS_COLOR);
 }
 
-int WaveManager::getEnemyCountToinit() {
-    return *waveCount * WaveManager::INIT_ENEMY_COUNT;
-}
-
 int WaveManager::getRandomNumber(const int& max) {
     int threeFourthOfMax;
 
@@ -114,11 +104,9 @@ int WaveManager::getRandomNumber(const int& max) {
         }
     }
 
-    std::random_device dev;
-    std::mt19937 rng(dev());
     std::uniform_int_distribution<std::mt19937::result_type> dist6(1, threeFourthOfMax);
 
-    return dist6(rng);
+    return dist6(GameRandom::getEngine());
 }
 
 void WaveManager::resetWaveCount() {
@@ -130,7 +118,10 @@ void WaveManager::resetWaveCount() {
 }
 
 void WaveManager::clearEnemies() {
+    spawnScheduler.clear();
     enemies.clear();
+    enemyBounds.clear();
+    ticksUntilFlowFieldRebuild = 0;
 }
 
 void WaveManager::resetGame() {
@@ -145,145 +136,203 @@ void WaveManager::setWaveCount(int waveCount) {
 }
 
 void WaveManager::initWave() {
-    GameSound::getInstance()->stopSoundFX();
-
-    int enemyCount = getEnemyCountToinit();
+    AllocationTagScope allocationTag(Allocation_Tag::SPAWN);
 
-    // Normal Enemies Fast
-    if (*waveCount > 3) {
-        int fastEnemyCount = getRandomNumber(enemyCount);
+    GameHost::getInstance()->runOnMainThread([] { GameSound::getInstance()->stopSoundFX(); });
 
-        for (int enemyIndex = 0; enemyIndex < fastEnemyCount; enemyIndex++) {
-            std::shared_ptr<FastEnemy> fastNormalEnemy = std::dynamic_pointer_cast<FastEnemy>(
-                PrototypeRegistry::getInstance()->getPrototype(Prototype_Type::NORMAL_ENEMY_FAST)
-            );
+    const WaveRow row = waveTable.getRow(*waveCount);
 
-            fastNormalEnemy->initPos();
-            enemies.push_back(fastNormalEnemy);
-        }
+    if (row.announced) {
+        GameHost::getInstance()->runOnMainThread([] { GameSound::getInstance()->playSoundFX(SFX::largeEnemySpawned); });
     }
 
-    // Medium Enemies
-    if (*waveCount > 8) {
-        int mediumEnemyCount = getRandomNumber(static_cast<int>(enemyCount / 2));
+    enemies.reserve(enemies.size() + row.maxEnemies);
 
-        for (int enemyIndex = 0; enemyIndex < mediumEnemyCount; enemyIndex++) {
-            std::shared_ptr<EnemyType> mediumEnemy = std::dynamic_pointer_cast<EnemyType>(
-                PrototypeRegistry::getInstance()->getPrototype(Prototype_Type::MEDIUM_ENEMY)
-            );
+    FrameVector<int> spawnedCounts; // Per spawn of the row, scaled spawns read the count they scale
+    for (size_t spawnIndex = row.firstSpawn; spawnIndex < row.firstSpawn + row.spawnCount; spawnIndex++) {
+        const WaveSpawn& spawn = waveTable.getSpawn(spawnIndex);
 
-            mediumEnemy->initPos();
-            enemies.push_back(mediumEnemy);
-        }
+        int count = spawn.count;
+        if (spawn.scaleSpawn >= 0) count = WaveTable::getScaledCount(spawn, spawnedCounts[spawn.scaleSpawn]);
+        if (spawn.random) count = getRandomNumber(count);
 
-        // Fast Medium Enemies
-        if (*waveCount > 16) {
-            int fastMediumEnemyCount = getRandomNumber(static_cast<int>(mediumEnemyCount / 2));
+        spawnedCounts.push_back(count);
+        spawnScheduler.queue(spawn.type, count);
+    }
 
-            for (int enemyIndex = 0; enemyIndex < fastMediumEnemyCount; enemyIndex++) {
-                std::shared_ptr<FastEnemy> fastMediumEnemy = std::dynamic_pointer_cast<FastEnemy>(
-                    PrototypeRegistry::getInstance()->getPrototype(Prototype_Type::MEDIUM_ENEMY_FAST)
-                );
+    placePendingSpawns();
+}
 
-                fastMediumEnemy->initPos();
-                enemies.push_back(fastMediumEnemy);
-            }
-        }
+std::shared_ptr<EnemyType> WaveManager::createEnemy(Prototype_Type type) {
+    return std::dynamic_pointer_cast<EnemyType>(PrototypeRegistry::getInstance()->getPrototype(type));
+}
+
+// One batch for everything queued, clear of the enemies already standing and of every living player
+void WaveManager::placePendingSpawns() {
+    if (spawnScheduler.isEmpty()) return;
+
+    spawnDimensions.clear();
+    spawnScheduler.forEachPendingRun([this](Prototype_Type type, int count) {
+        const EnemyType* prototype = dynamic_cast<const EnemyType*>(PrototypeRegistry::getInstance()->findPrototype(type));
+        const SDL_Point dimension = prototype ? prototype->getDimension() : SDL_Point{ 0, 0 };
+        spawnDimensions.insert(spawnDimensions.end(), static_cast<size_t>(count), dimension);
+    });
+
+    spawnObstacles.clear();
+    for (const auto& enemy : enemies) {
+        const SDL_Point& position = enemy->getPosition();
+        const SDL_Point& dimension = enemy->getDimension();
+        spawnObstacles.push_back({ position.x, position.y, dimension.x, dimension.y });
     }
 
-    // Large Enemies
-    if (*waveCount % 5 == 0 && *waveCount > 9) {
-        GameSound::getInstance()->playSoundFX(SFX::largeEnemySpawned);
+    spawnPlatforms.clear();
+    for (const auto& player : InvokerPlaying::getInstance()->players) {
+        if (*player.second->alive) spawnPlatforms.push_back(*player.second->platformPosition);
+    }
 
-        int largeEnemyCount = 1;
+    spawnPlacement.place(spawnDimensions, spawnObstacles, spawnPlatforms, World::getInstance()->getDimension(),
+        spawnPositions);
+    spawnScheduler.assignPositions(spawnPositions);
+}
 
-        std::shared_ptr<EnemyType> largeEnemy = std::dynamic_pointer_cast<EnemyType>(
-            PrototypeRegistry::getInstance()->getPrototype(Prototype_Type::LARGE_ENEMY)
-        );
+void WaveManager::releaseSpawns(bool unbudgeted) {
+    if (spawnScheduler.isEmpty()) return;
 
-        largeEnemy->initPos();
-        enemies.push_back(largeEnemy);
-        // Fast Large Enemies
-        if (*waveCount > 19) {
-            int fastLargeEnemyCount = getRandomNumber(static_cast<int>(enemyCount / 10));
+    AllocationTagScope allocationTag(Allocation_Tag::SPAWN);
 
-            for (int enemyIndex = 0; enemyIndex < fastLargeEnemyCount; enemyIndex++) {
-                std::shared_ptr<FastEnemy> fastLargeEnemy = std::dynamic_pointer_cast<FastEnemy>(
-                    PrototypeRegistry::getInstance()->getPrototype(Prototype_Type::LARGE_ENEMY_FAST)
-                );
+    spawnScheduler.release([this](Prototype_Type type, const SDL_Point* position) {
+        std::shared_ptr<EnemyType> enemy = createEnemy(type);
+        if (position) *enemy->position = *position;
+        else enemy->initPos();
 
-                fastLargeEnemy->initPos();
-                enemies.push_back(fastLargeEnemy);
-            }
-        }
+        enemy->startSpawnIn();
+        enemies.push_back(enemy);
+    }, unbudgeted);
+}
+
+void WaveManager::flushSpawns() {
+    releaseSpawns(true);
+}
+
+void WaveManager::setFixedSpawnRelease(bool fixedRelease) {
+    spawnScheduler.setFixedRelease(fixedRelease);
+}
+
+void WaveManager::spawnEnemies(Prototype_Type type, int count) {
+    for (int enemyIndex = 0; enemyIndex < count; enemyIndex++) {
+        std::shared_ptr<EnemyType> enemy = createEnemy(type);
+        enemy->initPos();
+        enemies.push_back(enemy);
     }
+}
 
-    // Normal Enemies
-    for (int enemyIndex = 0; enemyIndex < enemyCount; enemyIndex++) {
-        std::shared_ptr<EnemyType> normalEnemy = std::dynamic_pointer_cast<EnemyType>(
-            PrototypeRegistry::getInstance()->getPrototype(Prototype_Type::NORMAL_ENEMY)
-        );
-        normalEnemy->initPos();
-        enemies.push_back(normalEnemy);
+// Crowd costs come from last tick's bounds, which is close enough for a field rebuilt every few ticks
+void WaveManager::rebuildFlowField() {
+    FrameVector<SDL_Point> sources;
+
+    for (const auto& player : InvokerPlaying::getInstance()->players) {
+        if (*player.second->alive) sources.push_back(*player.second->platformPosition);
     }
-    
+
+    flowField.build(sources, enemyBounds, World::getInstance()->getDimension());
 }
 
 void WaveManager::updateEnemies() {
-    std::vector<std::shared_ptr<Enemy>> deadEnemiesToRemove;
-
-    for (auto& enemy : enemies) {
-        enemy->update();
-        enemy->checkCollision();
-        if (enemy->isDead()) {
-            deadEnemiesToRemove.push_back(enemy);
-            if (enemy->getType() == Prototype_Type::NORMAL_ENEMY || 
-                enemy->getType() == Prototype_Type::NORMAL_ENEMY_FAST) {
-                GameSound::getInstance()->playSoundFX(SFX::normalEnemyDead);
-            } else if (enemy->getType() == Prototype_Type::MEDIUM_ENEMY ||
-                enemy->getType() == Prototype_Type::MEDIUM_ENEMY_FAST) {
-                GameSound::getInstance()->playSoundFX(SFX::mediumEnemyDead);
-            } else if (enemy->getType() == Prototype_Type::LARGE_ENEMY ||
-                enemy->getType() == Prototype_Type::LARGE_ENEMY_FAST) {
-                GameSound::getInstance()->playSoundFX(SFX::largeEnemyDead);
-            }
+    JobSystem* jobSystem = GameHost::getInstance()->getJobSystem();
+    const size_t enemyCount = enemies.size();
+
+    if (ticksUntilFlowFieldRebuild-- <= 0) {
+        rebuildFlowField();
+        ticksUntilFlowFieldRebuild = FLOW_FIELD_INTERVAL_TICKS - 1;
+    }
+
+    // Steering and movement only touch the enemy being updated
+    jobSystem->parallelFor(enemyCount, ENEMY_CHUNK_SIZE, [this](size_t begin, size_t end, size_t) {
+        for (size_t enemyIndex = begin; enemyIndex < end; enemyIndex++) {
+            enemies[enemyIndex]->update(flowField);
         }
+    });
+
+    enemyBounds.resize(enemyCount);
+    for (size_t enemyIndex = 0; enemyIndex < enemyCount; enemyIndex++) {
+        const SDL_Point& position = enemies[enemyIndex]->getPosition();
+        const SDL_Point& dimension = enemies[enemyIndex]->getDimension();
+        enemyBounds[enemyIndex] = { position.x, position.y, dimension.x, dimension.y };
     }
+    enemyGrid.build(enemyBounds, World::getInstance()->getDimension());
 
-    removeDeadEnemies(deadEnemiesToRemove);
-}
+    jobSystem->parallelFor(enemyCount, ENEMY_CHUNK_SIZE, [this](size_t begin, size_t end, size_t) {
+        for (size_t enemyIndex = begin; enemyIndex < end; enemyIndex++) {
+            enemies[enemyIndex]->checkCollision(enemyGrid, enemyIndex);
+        }
+    });
 
-void WaveManager::updatePlayerScoreText() {
-    playerScoreText->setText("Score: " + std::to_string(Player::staticScore));
-    playerScoreText->loadText();
+    removeDeadEnemies();
 }
 
-void WaveManager::removeDeadEnemies(const std::vector<std::shared_ptr<Enemy>>& deadEnemiesToRemove) {
-    for (const auto& enemy : deadEnemiesToRemove) {
-        enemies.erase(
-            std::remove_if(
-                enemies.begin(),
-                enemies.end(),
-                [&enemy](const std::shared_ptr<Enemy>& e) {
-                    return e == enemy;
-                }),
-            enemies.end());
+void WaveManager::updateHudTexts(const HudRenderState& hud) {
+    AllocationTagScope allocationTag(Allocation_Tag::HUD);
+
+    if (hud.waveCount != shownWaveCount) {
+        shownWaveCount = hud.waveCount;
+        char text[HUD_TEXT_CAPACITY];
+        SDL_snprintf(text, sizeof(text), " Wave: %d", hud.waveCount);
+        waveCountText->setText(text);
+        waveCountText->loadText();
+    }
+
+    if (hud.score != shownScore) {
+        shownScore = hud.score;
+        char text[HUD_TEXT_CAPACITY];
+        SDL_snprintf(text, sizeof(text), "Score: %d", hud.score);
+        playerScoreText->setText(text);
+        playerScoreText->loadText();
     }
 }
 
+// One pass on this thread, so death sounds are queued in enemy order, same as a single-threaded update
+void WaveManager::removeDeadEnemies() {
+    enemies.erase(
+        std::remove_if(
+            enemies.begin(),
+            enemies.end(),
+            [](const std::shared_ptr<EnemyType>& enemy) {
+                if (!enemy->isDead()) return false;
+
+                SFX deathSound = SFX::normalEnemyDead;
+                if (enemy->getType() == Prototype_Type::MEDIUM_ENEMY ||
+                    enemy->getType() == Prototype_Type::MEDIUM_ENEMY_FAST) {
+                    deathSound = SFX::mediumEnemyDead;
+                } else if (enemy->getType() == Prototype_Type::LARGE_ENEMY ||
+                    enemy->getType() == Prototype_Type::LARGE_ENEMY_FAST) {
+                    deathSound = SFX::largeEnemyDead;
+                }
+
+                GameHost::getInstance()->runOnMainThread([deathSound] { GameSound::getInstance()->playSoundFX(deathSound); });
+                return true;
+            }),
+        enemies.end());
+}
+
 void WaveManager::update() {
+    releaseSpawns(false);
     updateEnemies();
-    countdownBar->update(static_cast<float>(countdownTimer->getDurationTime() - countdownTimer->getElapsedTime()));
-    updatePlayerScoreText();
 }
 
+void WaveManager::saveHudState(HudRenderState& hud) const {
+    hud.waveCount = *waveCount;
+    hud.score = Player::staticScore;
+    hud.countdownVisible = !isCountdownFinish();
+    hud.countdownDuration = countdownTimer->getDurationTime();
+    hud.countdownRemaining = static_cast<float>(countdownTimer->getDurationTime() - countdownTimer->getElapsedTime());
+}
 
-void WaveManager::render() {
-    for (auto& enemy : enemies) {
-        enemy->render();
-    }
-    
-    if (!isCountdownFinish()) {
+void WaveManager::render(const HudRenderState& hud) {
+    updateHudTexts(hud);
+
+    if (hud.countdownVisible) {
+        setCountdownMaxAmount(hud.countdownDuration);
+        countdownBar->update(hud.countdownRemaining);
         countdownText->render();
         countdownBar->render();
     }
@@ -293,7 +342,7 @@ void WaveManager::render() {
 }
 
 bool WaveManager::isWaveFinish() const {
-    return enemies.empty();
+    return enemies.empty() && spawnScheduler.isEmpty();
 }
 
 void WaveManager::incrementWave() {
@@ -304,11 +353,15 @@ void WaveManager::startCountdown() {
     if (*waveCount == 0) {
         countdownTimer->setFinish();
     } else {
-        Uint32 duration = getCountdownDuration();
-        setCountdownMaxAmount(duration);
+        Uint32 duration = waveTable.getRow(*waveCount).countdownMs;
         countdownTimer->setDuration(duration);
         countdownTimer->start();
-        GameSound::getInstance()->playSoundFX(SFX::ticking);
+        GameHost::getInstance()->runOnMainThread([] { GameSound::getInstance()->playSoundFX(SFX::ticking); });
+    }
+
+    // The wave count is incremented right after the countdown starts
+    if (waveTable.getRow(*waveCount + 1).announced) {
+        GameHost::getInstance()->runOnMainThread([] { GameSound::getInstance()->prefetchSoundFX(SFX::largeEnemySpawned); });
     }
 }
 
@@ -320,11 +373,6 @@ bool WaveManager::hasCountdownStarted() const {
     return countdownTimer->hasStarted();
 }
 
-void WaveManager::updateWaveCountText() {
-    waveCountText->setText(" Wave: " +  std::to_string(*waveCount));
-    waveCountText->loadText();
-}
-
 void WaveManager::setCountdownFinish() {
     countdownTimer->setFinish();
 }
@@ -347,11 +395,46 @@ void WaveManager::decreasePlayersFiringCooldown() {
     }
 }
 
+void WaveManager::saveSnapshot(WorldSnapshot& snapshot) const {
+    snapshot.waveCount = *waveCount;
+    snapshot.countdownDuration = countdownTimer->getDurationTime();
+    snapshot.countdownElapsed = countdownTimer->getElapsedTime();
+    snapshot.countdownStarted = countdownTimer->hasStarted();
+
+    for (const auto& enemy : enemies) {
+        if (enemy->isDead()) continue;
+
+        snapshot.enemies.push_back({ enemy->getType(), enemy->getPosition(), enemy->getHealth() });
+    }
+
+    spawnScheduler.save(snapshot.pendingSpawns, snapshot.pendingSpawnPositions);
+}
+
+void WaveManager::restoreSnapshot(const WorldSnapshot& snapshot) {
+    AllocationTagScope allocationTag(Allocation_Tag::SPAWN);
+
+    *waveCount = snapshot.waveCount;
+    countdownTimer->restore(snapshot.countdownDuration, snapshot.countdownElapsed, snapshot.countdownStarted);
+
+    clearEnemies();
+    for (const auto& enemySnapshot : snapshot.enemies) {
+        std::shared_ptr<EnemyType> enemy = std::dynamic_pointer_cast<EnemyType>(
+            PrototypeRegistry::getInstance()->getPrototype(enemySnapshot.type)
+        );
+
+        if (!enemy) continue;
+
+        enemy->restoreState(enemySnapshot.position, enemySnapshot.healthCount);
+        enemies.push_back(enemy);
+    }
+
+    spawnScheduler.restore(snapshot.pendingSpawns, snapshot.pendingSpawnPositions);
+}
 
 const int& WaveManager::getWaveCount() const {
     return *WaveManager::waveCount;
 }
 
-const std::vector<std::shared_ptr<Enemy>>& WaveManager::getEnemies() const {
+const std::vector<std::shared_ptr<EnemyType>>& WaveManager::getEnemies() const {
     return enemies;
 }
\ No newline at end of file
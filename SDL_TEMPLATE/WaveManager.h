@@ -2,11 +2,19 @@
 #include "SDL.h"
 #include <memory>
 #include <vector>
-
-class Enemy;
+#include "SpatialGrid.h"
+#include "FlowField.h"
+#include "GameEnums.h"
+#include "WaveTable.h"
+#include "SpawnScheduler.h"
+#include "SpawnPlacement.h"
+
+class EnemyType;
 class CountdownTimer;
 class Bar;
 class Text;
+struct WorldSnapshot;
+struct HudRenderState;
 
 class WaveManager {
 private:
@@ -23,9 +31,11 @@ public:
 private:
     constexpr static int PLAYER_FIRING_COOLDOWN_DECREASER = 65;
     constexpr static int PLAYER_FIRING_COOLDOWN_LIMIT = 60;
-    constexpr static int INIT_ENEMY_COUNT = 4;
     constexpr static int COUNTDOWN_BAR_BORDER_THICK = 3;
     constexpr static SDL_Color COUNTDOWN_BAR_PROGRESS_COLOR = { 181, 0, 0, 255 };
+    constexpr static size_t ENEMY_CHUNK_SIZE = 64;
+    constexpr static int FLOW_FIELD_INTERVAL_TICKS = 3;
+    constexpr static int HUD_TEXT_CAPACITY = 32;
     static std::unique_ptr<int> waveCount;
     static std::unique_ptr<CountdownTimer> countdownTimer;
     static std::unique_ptr<Bar> countdownBar;
@@ -33,7 +43,20 @@ private:
     static std::unique_ptr<Text> waveCountText;
     static std::unique_ptr<Text> playerScoreText;
     static std::unique_ptr<bool> waveCountFromLoadFile;
-    std::vector<std::shared_ptr<Enemy>> enemies;
+    std::vector<std::shared_ptr<EnemyType>> enemies;
+    std::vector<SDL_Rect> enemyBounds; // Post-move bounds every enemy separates against
+    WaveTable waveTable;
+    SpawnScheduler spawnScheduler;
+    SpawnPlacement spawnPlacement;
+    std::vector<SDL_Point> spawnDimensions; // Scratch for placing a queued wave, kept for the capacity
+    std::vector<SDL_Rect> spawnObstacles;
+    std::vector<SDL_Point> spawnPlatforms;
+    std::vector<SDL_Point> spawnPositions;
+    SpatialGrid enemyGrid;
+    FlowField flowField;
+    int ticksUntilFlowFieldRebuild;
+    int shownWaveCount; // Last values baked into the HUD texts
+    int shownScore;
 
 public:
     static SDL_Rect getCountdownTextDstRect();
@@ -41,26 +64,31 @@ public:
     static void initTexts();
 
 private:
-    Uint32 getCountdownDuration() const;
     void setCountdownMaxAmount(Uint32 duration);
+    std::shared_ptr<EnemyType> createEnemy(Prototype_Type type);
+    void placePendingSpawns();
+    void releaseSpawns(bool unbudgeted);
+    void rebuildFlowField();
     void updateEnemies();
-    void updatePlayerScoreText();
-    void removeDeadEnemies(const std::vector<std::shared_ptr<Enemy>>& enemiesToRemove);
-    int getEnemyCountToinit();
+    void updateHudTexts(const HudRenderState& hud);
+    void removeDeadEnemies();
     int getRandomNumber(const int& max);
     void resetWaveCount();
-    void clearEnemies();
 
 public:
     void initCountdownBar();
 
     void resetGame();
+    void clearEnemies();
 
     void setWaveCount(int waveCount);
 
-    void initWave();
+    void initWave(); // Queues the wave, update releases it over the next ticks
+    void flushSpawns(); // Releases the whole queued wave at once
+    void setFixedSpawnRelease(bool fixedRelease); // A fixed count per tick instead of a time budget, for reproducible runs
+    void spawnEnemies(Prototype_Type type, int count); // At random positions inside the world border, right away
     void update();
-    void render();
+    void render(const HudRenderState& hud);
 
     bool isWaveFinish() const;
     void incrementWave();
@@ -68,14 +96,17 @@ public:
     void startCountdown();
     bool isCountdownFinish() const;
     bool hasCountdownStarted() const;
-    void updateWaveCountText();
     void setCountdownFinish();
     void pauseCountdownTimer();
     void unpauseCountdownTimer();
 
     void decreasePlayersFiringCooldown();
 
+    void saveSnapshot(WorldSnapshot& snapshot) const;
+    void restoreSnapshot(const WorldSnapshot& snapshot);
+    void saveHudState(HudRenderState& hud) const;
+
     const int& getWaveCount() const;
-    const std::vector<std::shared_ptr<Enemy>>& getEnemies() const;
+    const std::vector<std::shared_ptr<EnemyType>>& getEnemies() const;
 };
 
@@ -0,0 +1,197 @@
+#include "WaveTable.h"
+#include "Logger.h"
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+WaveTable::WaveTable() {}
+
+// Used when the manifest is missing, mirrors assets/waves/waves.manifest
+std::vector<WaveRule> WaveTable::getDefaultRules() {
+	std::vector<WaveRule> defaults = {
+		{ Prototype_Type::NORMAL_ENEMY_FAST, 4, 0, 1, 0.0, 4.0, false, Prototype_Type::NORMAL_ENEMY, true, false },
+		{ Prototype_Type::MEDIUM_ENEMY, 9, 0, 1, 0.0, 2.0, false, Prototype_Type::NORMAL_ENEMY, true, false },
+		{ Prototype_Type::MEDIUM_ENEMY_FAST, 17, 0, 1, 0.0, 0.5, true, Prototype_Type::MEDIUM_ENEMY, true, false },
+		{ Prototype_Type::LARGE_ENEMY, 10, 0, 5, 1.0, 0.0, false, Prototype_Type::NORMAL_ENEMY, false, true },
+		{ Prototype_Type::LARGE_ENEMY_FAST, 20, 0, 5, 0.0, 0.4, false, Prototype_Type::NORMAL_ENEMY, true, false },
+		{ Prototype_Type::NORMAL_ENEMY, 1, 0, 1, 0.0, 4.0, false, Prototype_Type::NORMAL_ENEMY, false, false }
+	};
+
+	return defaults;
+}
+
+std::vector<CountdownStep> WaveTable::getDefaultCountdownSteps() {
+	std::vector<CountdownStep> defaults = {
+		{ 6, 3500 },
+		{ 11, 5000 },
+		{ 20, 7000 },
+		{ 0, 10000 }
+	};
+
+	return defaults;
+}
+
+bool WaveTable::parseType(const std::string& name, Prototype_Type& type) {
+	if (name == "normalEnemy") type = Prototype_Type::NORMAL_ENEMY;
+	else if (name == "normalEnemyFast") type = Prototype_Type::NORMAL_ENEMY_FAST;
+	else if (name == "mediumEnemy") type = Prototype_Type::MEDIUM_ENEMY;
+	else if (name == "mediumEnemyFast") type = Prototype_Type::MEDIUM_ENEMY_FAST;
+	else if (name == "largeEnemy") type = Prototype_Type::LARGE_ENEMY;
+	else if (name == "largeEnemyFast") type = Prototype_Type::LARGE_ENEMY_FAST;
+	else return false;
+
+	return true;
+}
+
+bool WaveTable::appliesTo(const WaveRule& rule, int wave) {
+	if (wave < rule.firstWave) return false;
+	if (rule.lastWave > 0 && wave > rule.lastWave) return false;
+
+	return (wave - rule.firstWave) % rule.period == 0;
+}
+
+// The small bias keeps counts like 0.29 * 100 from flooring one short
+int WaveTable::getCount(double base, double scale, int amount) {
+	const double count = std::floor(base + scale * amount + 1e-9);
+	return count > 0.0 ? static_cast<int>(count) : 0;
+}
+
+int WaveTable::getScaledCount(const WaveSpawn& spawn, int scaleCount) {
+	return getCount(spawn.base, spawn.scale, scaleCount);
+}
+
+// Manifest lines: spawn <type> <firstWave> <lastWave> <period> <base> <perWave> <scaleOf type|-> <random 0|1> <announced 0|1>
+//                 countdown <lastWave> <durationMs>
+bool WaveTable::loadManifest() {
+	std::ifstream manifest(MANIFEST_PATH);
+
+	if (!manifest) {
+		LOG_INFO("Wave manifest %s not found, using built-in wave rules.", MANIFEST_PATH);
+		return false;
+	}
+
+	std::vector<WaveRule> loadedRules;
+	std::vector<CountdownStep> loadedSteps;
+
+	std::string line;
+	int lineNumber = 0;
+	while (std::getline(manifest, line)) {
+		++lineNumber;
+		if (line.empty() || line[0] == '#') continue;
+
+		std::istringstream fields(line);
+		std::string kind;
+		fields >> kind;
+
+		if (kind == "spawn") {
+			WaveRule rule = {};
+			std::string typeName;
+			std::string scaleOfName;
+			int random = 0;
+			int announced = 0;
+
+			if (!(fields >> typeName >> rule.firstWave >> rule.lastWave >> rule.period >> rule.base >> rule.perWave
+				>> scaleOfName >> random >> announced) || !parseType(typeName, rule.type) || rule.period <= 0) {
+				LOG_WARNING("Skipping malformed wave manifest line %d", lineNumber);
+				continue;
+			}
+
+			rule.scaled = scaleOfName != "-";
+			if (rule.scaled && !parseType(scaleOfName, rule.scaleOf)) {
+				LOG_WARNING("Skipping malformed wave manifest line %d", lineNumber);
+				continue;
+			}
+
+			rule.random = random != 0;
+			rule.announced = announced != 0;
+			loadedRules.push_back(rule);
+		} else if (kind == "countdown") {
+			CountdownStep step = {};
+
+			if (!(fields >> step.lastWave >> step.durationMs)) {
+				LOG_WARNING("Skipping malformed wave manifest line %d", lineNumber);
+				continue;
+			}
+
+			loadedSteps.push_back(step);
+		} else if (!kind.empty()) {
+			LOG_WARNING("Skipping unknown wave manifest line %d", lineNumber);
+		}
+	}
+
+	// A manifest that only retunes one half keeps the built-in other half
+	if (!loadedRules.empty()) rules = std::move(loadedRules);
+	if (!loadedSteps.empty()) countdownSteps = std::move(loadedSteps);
+
+	return true;
+}
+
+void WaveTable::load() {
+	rules = getDefaultRules();
+	countdownSteps = getDefaultCountdownSteps();
+
+	loadManifest();
+
+	rows.clear();
+	spawns.clear();
+	for (int wave = 0; wave <= PRECOMPILED_WAVES; wave++) {
+		compileRow(wave);
+	}
+
+	LOG_DEBUG("Wave table compiled %u rules into %u rows.", static_cast<unsigned>(rules.size()),
+		static_cast<unsigned>(rows.size()));
+}
+
+Uint32 WaveTable::getCountdownDuration(int wave) const {
+	for (const auto& step : countdownSteps) {
+		if (step.lastWave <= 0 || wave <= step.lastWave) return step.durationMs;
+	}
+
+	return countdownSteps.empty() ? FALLBACK_COUNTDOWN_MS : countdownSteps.back().durationMs;
+}
+
+// Rows are appended in wave order
+void WaveTable::compileRow(int wave) {
+	WaveRow row = { spawns.size(), 0, 0, getCountdownDuration(wave), false };
+
+	for (const auto& rule : rules) {
+		if (wave <= 0 || !appliesTo(rule, wave)) continue;
+
+		int scaleSpawn = -1;
+		int count = getCount(rule.base, rule.perWave, wave);
+
+		if (rule.scaled) {
+			for (size_t spawnIndex = row.firstSpawn; spawnIndex < spawns.size(); spawnIndex++) {
+				if (spawns[spawnIndex].type == rule.scaleOf) scaleSpawn = static_cast<int>(spawnIndex - row.firstSpawn);
+			}
+			if (scaleSpawn < 0) continue;
+
+			const WaveSpawn& scaledFrom = spawns[row.firstSpawn + scaleSpawn];
+			count = getCount(rule.base, rule.perWave, scaledFrom.random && scaledFrom.count < 1 ? 1 : scaledFrom.count);
+		}
+
+		// A roll never spawns fewer than one enemy, a fixed count of zero spawns none
+		if (!rule.random && !rule.scaled && count == 0) continue;
+
+		spawns.push_back({ rule.type, count, rule.random, scaleSpawn, rule.base, rule.perWave });
+		row.spawnCount++;
+		row.maxEnemies += rule.random && count < 1 ? 1 : count;
+		row.announced = row.announced || rule.announced;
+	}
+
+	rows.push_back(row);
+}
+
+WaveRow WaveTable::getRow(int wave) {
+	if (wave < 0) wave = 0;
+
+	while (static_cast<int>(rows.size()) <= wave) {
+		compileRow(static_cast<int>(rows.size()));
+	}
+
+	return rows[wave];
+}
+
+const WaveSpawn& WaveTable::getSpawn(size_t spawnIndex) const {
+	return spawns[spawnIndex];
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <SDL.h>
+#include <string>
+#include <vector>
+#include "GameEnums.h"
+
+// Applies from firstWave to lastWave (0 for no end), every period waves. The count is base + perWave * wave,
+// or a roll between 1 and 7/8 of it when random. A scaled rule multiplies the count an earlier rule of type
+// scaleOf got in the same wave instead of the wave number, and is skipped on waves that rule does not spawn.
+struct WaveRule {
+	Prototype_Type type;
+	int firstWave;
+	int lastWave;
+	int period;
+	double base;
+	double perWave;
+	bool scaled;
+	Prototype_Type scaleOf;
+	bool random;
+	bool announced; // Plays largeEnemySpawned, prefetched during the countdown before
+};
+
+struct CountdownStep {
+	int lastWave; // 0 for every later wave
+	Uint32 durationMs;
+};
+
+struct WaveSpawn {
+	Prototype_Type type;
+	int count; // Exact, or the upper bound of the roll, for a scaled spawn the largest it can get
+	bool random;
+	int scaleSpawn; // Earlier spawn of the same row whose count this one scales, -1 when it does not
+	double base;
+	double scale;
+};
+
+struct WaveRow {
+	size_t firstSpawn; // Into the flat spawn list
+	size_t spawnCount;
+	int maxEnemies; // Largest possible wave, reserved before the bulk insert
+	Uint32 countdownMs; // Countdown after this wave
+	bool announced;
+};
+
+// Wave rules from assets/waves/waves.manifest, compiled into one row per wave over a flat spawn list, so starting
+// a wave is a row lookup. Rows past the precompiled range are compiled when a wave first reaches them.
+class WaveTable {
+private:
+	constexpr static const char* MANIFEST_PATH = "assets/waves/waves.manifest";
+	constexpr static int PRECOMPILED_WAVES = 64;
+	constexpr static Uint32 FALLBACK_COUNTDOWN_MS = 1000;
+
+	std::vector<WaveRule> rules;
+	std::vector<CountdownStep> countdownSteps;
+	std::vector<WaveRow> rows; // Indexed by wave, row 0 is empty
+	std::vector<WaveSpawn> spawns;
+
+private:
+	static std::vector<WaveRule> getDefaultRules();
+	static std::vector<CountdownStep> getDefaultCountdownSteps();
+	static bool parseType(const std::string& name, Prototype_Type& type);
+	static bool appliesTo(const WaveRule& rule, int wave);
+	static int getCount(double base, double scale, int amount);
+
+	bool loadManifest();
+	Uint32 getCountdownDuration(int wave) const;
+	void compileRow(int wave);
+
+public:
+	WaveTable();
+
+	void load(); // Built-in rules when the manifest is missing
+	WaveRow getRow(int wave);
+	const WaveSpawn& getSpawn(size_t spawnIndex) const;
+
+	// Count bound of a scaled spawn, given what its scaleSpawn got this wave
+	static int getScaledCount(const WaveSpawn& spawn, int scaleCount);
+};
@@ -0,0 +1,34 @@
+#include "World.h"
+#include "AppInfo.h"
+
+World::World() : dimension({ 0, 0 }), srcRect({ SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2, SCREEN_WIDTH, SCREEN_HEIGHT }) {}
+
+World* World::getInstance() {
+	static World instance;
+	return &instance;
+}
+
+void World::init(const SDL_Point& dimension) {
+	this->dimension = dimension;
+	srcRect = { SCREEN_WIDTH / 2, SCREEN_HEIGHT / 2, SCREEN_WIDTH, SCREEN_HEIGHT };
+}
+
+bool World::isRightEdge() const {
+	return srcRect.x + srcRect.w >= dimension.x;
+}
+
+bool World::isLeftEdge() const {
+	return srcRect.x <= 0;
+}
+
+bool World::isUpEdge() const {
+	return srcRect.y <= 0;
+}
+
+bool World::isDownEdge() const {
+	return srcRect.y + srcRect.h >= dimension.y;
+}
+
+const SDL_Point& World::getDimension() const {
+	return dimension;
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <SDL.h>
+
+// The playing field and the part of it on screen. Background sizes it from its texture when it loads,
+// the simulation scrolls srcRect with the player and bounds everything by the dimension.
+class World {
+private:
+	World();
+
+private:
+	SDL_Point dimension;
+
+public:
+	SDL_Rect srcRect;
+
+public:
+	World(const World&) = delete;
+	World& operator=(const World&) = delete;
+	World(World&&) = delete;
+	World& operator=(World&&) = delete;
+
+	static World* getInstance();
+
+	void init(const SDL_Point& dimension);
+
+	bool isRightEdge() const;
+	bool isLeftEdge() const;
+	bool isUpEdge() const;
+	bool isDownEdge() const;
+	const SDL_Point& getDimension() const;
+};
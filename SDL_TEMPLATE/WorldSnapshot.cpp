@@ -0,0 +1,258 @@
+#include "WorldSnapshot.h"
+#include "WaveManager.h"
+#include "World.h"
+#include "InvokerPlaying.h"
+#include "Player.h"
+#include "Bullet.h"
+#include <cstring>
+
+namespace {
+	template <typename T>
+	void writeValue(std::vector<Uint8>& bytes, const T& value) {
+		size_t offset = bytes.size();
+		bytes.resize(offset + sizeof(T));
+		std::memcpy(bytes.data() + offset, &value, sizeof(T));
+	}
+
+	template <typename T>
+	bool readValue(const std::vector<Uint8>& bytes, size_t& offset, T& value) {
+		if (offset + sizeof(T) > bytes.size()) return false;
+
+		std::memcpy(&value, bytes.data() + offset, sizeof(T));
+		offset += sizeof(T);
+		return true;
+	}
+}
+
+void WorldSnapshot::capture() {
+	players.clear();
+	enemies.clear();
+	pendingSpawns.clear();
+	pendingSpawnPositions.clear();
+	bullets.clear();
+
+	WaveManager::getInstance()->saveSnapshot(*this);
+
+	backgroundSrcRect = World::getInstance()->srcRect;
+	staticScore = Player::staticScore;
+
+	for (const auto& player : InvokerPlaying::getInstance()->players) {
+		PlayerSnapshot playerSnapshot;
+		player.second->saveSnapshot(playerSnapshot);
+		players.push_back(playerSnapshot);
+	}
+
+	for (const auto& bullet : Bullet::bullets) {
+		if (*bullet->remove) continue;
+
+		BulletSnapshot bulletSnapshot;
+		bullet->saveSnapshot(bulletSnapshot);
+		bullets.push_back(bulletSnapshot);
+	}
+}
+
+void WorldSnapshot::apply() const {
+	World::getInstance()->srcRect = backgroundSrcRect;
+	Player::staticScore = staticScore;
+
+	WaveManager::getInstance()->restoreSnapshot(*this);
+
+	auto& livePlayers = InvokerPlaying::getInstance()->players;
+
+	for (const auto& playerSnapshot : players) {
+		auto it = livePlayers.find(playerSnapshot.ID);
+		if (it != livePlayers.end()) it->second->restoreSnapshot(playerSnapshot);
+	}
+
+	Bullet::bullets.clear();
+	for (const auto& bulletSnapshot : bullets) {
+		auto it = livePlayers.find(bulletSnapshot.playerID);
+		if (it != livePlayers.end()) it->second->restoreBullet(bulletSnapshot);
+	}
+}
+
+void WorldSnapshot::serialize(std::vector<Uint8>& bytes) const {
+	bytes.clear();
+
+	writeValue(bytes, waveCount);
+	writeValue(bytes, staticScore);
+	writeValue(bytes, countdownDuration);
+	writeValue(bytes, countdownElapsed);
+	writeValue(bytes, static_cast<Uint8>(countdownStarted));
+	writeValue(bytes, backgroundSrcRect);
+
+	writeValue(bytes, static_cast<Uint16>(players.size()));
+	// Field by field, copying the struct whole would write its padding bytes
+	for (const auto& player : players) {
+		writeValue(bytes, player.ID);
+		writeValue(bytes, player.heartAmount);
+		writeValue(bytes, player.sprintAmount);
+		writeValue(bytes, player.score);
+		writeValue(bytes, player.firingCooldown);
+		writeValue(bytes, player.firingElapsed);
+		writeValue(bytes, player.healElapsed);
+		writeValue(bytes, static_cast<Uint8>(player.firingTriggered));
+		writeValue(bytes, static_cast<Uint8>(player.healTriggered));
+		writeValue(bytes, player.position.x);
+		writeValue(bytes, player.position.y);
+		writeValue(bytes, player.platformPosition.x);
+		writeValue(bytes, player.platformPosition.y);
+		writeValue(bytes, player.directionX);
+		writeValue(bytes, player.directionY);
+		writeValue(bytes, static_cast<Uint8>(player.directionFacing));
+		writeValue(bytes, static_cast<Uint8>(player.alive));
+	}
+
+	// Enemies and bullets dominate the snapshot, so they are stored as 16-bit world coordinates
+	writeValue(bytes, static_cast<Uint32>(enemies.size()));
+	for (const auto& enemy : enemies) {
+		writeValue(bytes, static_cast<Uint8>(enemy.type));
+		writeValue(bytes, static_cast<Uint8>(enemy.healthCount));
+		writeValue(bytes, static_cast<Sint16>(enemy.position.x));
+		writeValue(bytes, static_cast<Sint16>(enemy.position.y));
+	}
+
+	writeValue(bytes, static_cast<Uint16>(pendingSpawns.size()));
+	for (const auto& spawn : pendingSpawns) {
+		writeValue(bytes, static_cast<Uint8>(spawn.type));
+		writeValue(bytes, static_cast<Uint16>(spawn.count));
+	}
+
+	writeValue(bytes, static_cast<Uint32>(pendingSpawnPositions.size()));
+	for (const auto& position : pendingSpawnPositions) {
+		writeValue(bytes, static_cast<Sint16>(position.x));
+		writeValue(bytes, static_cast<Sint16>(position.y));
+	}
+
+	writeValue(bytes, static_cast<Uint32>(bullets.size()));
+	for (const auto& bullet : bullets) {
+		writeValue(bytes, static_cast<Uint8>(bullet.playerID));
+		writeValue(bytes, static_cast<Sint16>(bullet.position.x));
+		writeValue(bytes, static_cast<Sint16>(bullet.position.y));
+		writeValue(bytes, bullet.directionX);
+		writeValue(bytes, bullet.directionY);
+	}
+}
+
+bool WorldSnapshot::deserialize(const std::vector<Uint8>& bytes) {
+	size_t offset = 0;
+	Uint8 started = 0;
+
+	if (!readValue(bytes, offset, waveCount) ||
+		!readValue(bytes, offset, staticScore) ||
+		!readValue(bytes, offset, countdownDuration) ||
+		!readValue(bytes, offset, countdownElapsed) ||
+		!readValue(bytes, offset, started) ||
+		!readValue(bytes, offset, backgroundSrcRect)) {
+		return false;
+	}
+	countdownStarted = started != 0;
+
+	Uint16 playerCount = 0;
+	if (!readValue(bytes, offset, playerCount)) return false;
+
+	players.resize(playerCount);
+	for (auto& player : players) {
+		Uint8 directionFacing = 0;
+		Uint8 alive = 0;
+		Uint8 firingTriggered = 0;
+		Uint8 healTriggered = 0;
+
+		if (!readValue(bytes, offset, player.ID) ||
+			!readValue(bytes, offset, player.heartAmount) ||
+			!readValue(bytes, offset, player.sprintAmount) ||
+			!readValue(bytes, offset, player.score) ||
+			!readValue(bytes, offset, player.firingCooldown) ||
+			!readValue(bytes, offset, player.firingElapsed) ||
+			!readValue(bytes, offset, player.healElapsed) ||
+			!readValue(bytes, offset, firingTriggered) ||
+			!readValue(bytes, offset, healTriggered) ||
+			!readValue(bytes, offset, player.position.x) ||
+			!readValue(bytes, offset, player.position.y) ||
+			!readValue(bytes, offset, player.platformPosition.x) ||
+			!readValue(bytes, offset, player.platformPosition.y) ||
+			!readValue(bytes, offset, player.directionX) ||
+			!readValue(bytes, offset, player.directionY) ||
+			!readValue(bytes, offset, directionFacing) ||
+			!readValue(bytes, offset, alive)) {
+			return false;
+		}
+
+		player.directionFacing = static_cast<Face_Direction>(directionFacing);
+		player.alive = alive != 0;
+		player.firingTriggered = firingTriggered != 0;
+		player.healTriggered = healTriggered != 0;
+	}
+
+	Uint32 enemyCount = 0;
+	if (!readValue(bytes, offset, enemyCount)) return false;
+
+	enemies.resize(enemyCount);
+	for (auto& enemy : enemies) {
+		Uint8 type = 0;
+		Uint8 healthCount = 0;
+		Sint16 x = 0;
+		Sint16 y = 0;
+
+		if (!readValue(bytes, offset, type) ||
+			!readValue(bytes, offset, healthCount) ||
+			!readValue(bytes, offset, x) ||
+			!readValue(bytes, offset, y)) {
+			return false;
+		}
+
+		enemy.type = static_cast<Prototype_Type>(type);
+		enemy.healthCount = healthCount;
+		enemy.position = { x, y };
+	}
+
+	Uint16 pendingSpawnCount = 0;
+	if (!readValue(bytes, offset, pendingSpawnCount)) return false;
+
+	pendingSpawns.resize(pendingSpawnCount);
+	for (auto& spawn : pendingSpawns) {
+		Uint8 type = 0;
+		Uint16 count = 0;
+
+		if (!readValue(bytes, offset, type) || !readValue(bytes, offset, count)) return false;
+
+		spawn.type = static_cast<Prototype_Type>(type);
+		spawn.count = count;
+	}
+
+	Uint32 pendingSpawnPositionCount = 0;
+	if (!readValue(bytes, offset, pendingSpawnPositionCount)) return false;
+
+	pendingSpawnPositions.resize(pendingSpawnPositionCount);
+	for (auto& position : pendingSpawnPositions) {
+		Sint16 x = 0;
+		Sint16 y = 0;
+
+		if (!readValue(bytes, offset, x) || !readValue(bytes, offset, y)) return false;
+
+		position = { x, y };
+	}
+
+	Uint32 bulletCount = 0;
+	if (!readValue(bytes, offset, bulletCount)) return false;
+
+	bullets.resize(bulletCount);
+	for (auto& bullet : bullets) {
+		Uint8 playerID = 0;
+		Sint16 x = 0;
+		Sint16 y = 0;
+
+		if (!readValue(bytes, offset, playerID) ||
+			!readValue(bytes, offset, x) ||
+			!readValue(bytes, offset, y) ||
+			!readValue(bytes, offset, bullet.directionX) ||
+			!readValue(bytes, offset, bullet.directionY)) {
+			return false;
+		}
+
+		bullet.playerID = playerID;
+		bullet.position = { x, y };
+	}
+
+	return true;
+}
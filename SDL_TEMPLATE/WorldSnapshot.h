@@ -0,0 +1,58 @@
+#pragma once
+#include <SDL.h>
+#include <vector>
+#include "GameEnums.h"
+#include "SpawnScheduler.h"
+
+struct PlayerSnapshot {
+	int ID;
+	int heartAmount;
+	int sprintAmount;
+	int score;
+	Uint32 firingCooldown;
+	Uint32 firingElapsed; // Cooldown progress, in milliseconds since the last shot and heal
+	Uint32 healElapsed;
+	bool firingTriggered;
+	bool healTriggered;
+	SDL_Point position;
+	SDL_Point platformPosition;
+	float directionX;
+	float directionY;
+	Face_Direction directionFacing;
+	bool alive;
+};
+
+struct EnemySnapshot {
+	Prototype_Type type;
+	SDL_Point position;
+	int healthCount;
+};
+
+struct BulletSnapshot {
+	int playerID;
+	SDL_Point position;
+	float directionX;
+	float directionY;
+};
+
+// Copyable picture of everything GamePlaying::update mutates.
+// Serialized form packs enemies and bullets into a few bytes each so whole waves stay cheap to store.
+struct WorldSnapshot {
+	int waveCount;
+	int staticScore;
+	Uint32 countdownDuration;
+	Uint32 countdownElapsed;
+	bool countdownStarted;
+	SDL_Rect backgroundSrcRect;
+	std::vector<PlayerSnapshot> players;
+	std::vector<EnemySnapshot> enemies;
+	std::vector<PendingSpawn> pendingSpawns; // Rest of a wave still being released
+	std::vector<SDL_Point> pendingSpawnPositions; // Where each of them was placed, in release order
+	std::vector<BulletSnapshot> bullets;
+
+	void capture();
+	void apply() const;
+
+	void serialize(std::vector<Uint8>& bytes) const;
+	bool deserialize(const std::vector<Uint8>& bytes);
+};
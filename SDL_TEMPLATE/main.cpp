@@ -1,27 +1,87 @@
 #include <SDL.h>
 #include "Game.h"
 #include "FPSManager.h"
+#include "GameClock.h"
+#include "EcsBenchmark.h"
+#include "SimulationBenchmarks.h"
+#include "SoakTest.h"
+#include "GameStressTest.h"
+#include "Telemetry.h"
+#include "FrameArena.h"
+#include "AllocationCounter.h"
+#include <cstring>
 
 // TODO : controller
 
-int SDL_main(int argc, char* argv[]) {
+// SDL.h renames main to SDL_main on platforms that need SDL2main for the entry point
+int main(int argc, char* argv[]) {
     Game* game = Game::getInstance();
+
+    // --uncapped, anywhere on the command line, turns off the frame pacer and vsync
+    for (int argIndex = 1; argIndex < argc; argIndex++) {
+        if (std::strcmp(argv[argIndex], "--uncapped") == 0) FPSManager::getInstance()->setUncapped(true);
+    }
+
+    // Headless, so these also run on CI machines without a display or audio device
+    if (argc > 1 && std::strcmp(argv[1], "--benchmark") == 0) {
+        game->setHeadless(true);
+        game->initAll();
+        const int result = SimulationBenchmarks::run(argc, argv);
+        game->close();
+        return result;
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "--soak") == 0) {
+        game->setHeadless(true);
+        game->initAll();
+        const int result = SoakTest::run(argc, argv);
+        game->close();
+        return result;
+    }
+
     game->initAll();
 
-    int countFramme = 0;
-    Uint32 startTime = SDL_GetTicks();
+    if (argc > 1 && std::strcmp(argv[1], "--ecs-benchmark") == 0) {
+        EcsBenchmark::run(EcsBenchmark::DEFAULT_ENTITY_COUNT, EcsBenchmark::DEFAULT_FRAME_COUNT);
+        game->close();
+        return 0;
+    }
+
+    // Windowed on purpose, the frame budget it searches for includes rendering and present
+    if (argc > 1 && std::strcmp(argv[1], "--stress") == 0) {
+        game->startGame();
+        game->setState(std::make_unique<GameStressTest>(StressConfig::parse(argc, argv)));
+    }
+
+    // --telemetry=<path> or --telemetry=unix:<socket path>, anywhere on the command line
+    for (int argIndex = 1; argIndex < argc; argIndex++) {
+        if (std::strncmp(argv[argIndex], "--telemetry=", 12) == 0) Telemetry::getInstance()->start(argv[argIndex] + 12);
+    }
 
+    FPSManager* fpsManager = FPSManager::getInstance();
 
     while (game->isRunning()) {
-        Uint32 frameStart = SDL_GetTicks();
+        Uint64 frameStart = GameClock::getRealTimeNs();
+
+        FrameArena::getThreadArena().reset();
+        AllocationCounter::beginFrame();
 
         game->input();
+        const bool idleFrame = game->isIdle();
+        Telemetry::getInstance()->beginFrame();
         game->update();
         game->render();
 
-        FPSManager::limitFPS(frameStart);
-        FPSManager::calculateAverageFPS(countFramme, startTime);
+        // Input waited and handled no event, so no thread had anything to allocate for
+        if (idleFrame) ASSERT_NO_FRAME_ALLOCATIONS();
+
+        fpsManager->limitFPS();
+        Telemetry::getInstance()->endFrame(GameClock::getRealTimeNs() - frameStart);
     }
 
+    fpsManager->logSessionReport();
+
+    game->close();
+
     return 0;
 }
\ No newline at end of file